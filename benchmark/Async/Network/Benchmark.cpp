@@ -0,0 +1,305 @@
+//
+//  Benchmark.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#include <signal.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		namespace Benchmark
+		{
+			namespace
+			{
+				struct Percentile
+				{
+					const char * name;
+					double value;
+				};
+				
+				const Percentile PERCENTILES[] = {{"p50", 50}, {"p90", 90}, {"p99", 99}, {"p99.9", 99.9}};
+				
+				// Latencies are recorded in nanoseconds and printed in microseconds:
+				double microseconds(std::uint64_t nanoseconds)
+				{
+					return nanoseconds / 1000.0;
+				}
+				
+				void write_histogram(std::ostream & output, const Histogram & histogram)
+				{
+					output << "{\"minimum\":" << histogram.minimum();
+					output << ",\"mean\":" << histogram.mean();
+					
+					for (auto percentile : PERCENTILES) {
+						output << ",\"" << percentile.name << "\":" << histogram.percentile(percentile.value);
+					}
+					
+					output << ",\"maximum\":" << histogram.maximum();
+					output << "}";
+				}
+				
+				std::vector<double> parse_rates(const std::string & text)
+				{
+					std::vector<double> rates;
+					std::size_t offset = 0;
+					
+					while (offset < text.size()) {
+						auto end = text.find(',', offset);
+						if (end == std::string::npos) end = text.size();
+						
+						auto rate = std::stod(text.substr(offset, end - offset));
+						
+						if (rate <= 0)
+							throw std::invalid_argument("Rates must be positive!");
+						
+						rates.push_back(rate);
+						offset = end + 1;
+					}
+					
+					return rates;
+				}
+			}
+			
+			void print(std::ostream & output, const Result & result)
+			{
+				auto & latency = result.latency;
+				
+				output << std::fixed << std::setprecision(1);
+				output << std::left << std::setw(12) << result.scenario << std::right;
+				
+				if (result.rate)
+					output << result.rate << " target, ";
+				
+				output << result.operations_per_second() << " op/s";
+				
+				if (result.bytes)
+					output << ", " << result.bytes_per_second() / (1024 * 1024) << " MiB/s";
+				
+				output << ", latency";
+				
+				for (auto percentile : PERCENTILES) {
+					output << " " << percentile.name << "=" << microseconds(latency.percentile(percentile.value)) << "us";
+				}
+				
+				output << " max=" << microseconds(latency.maximum()) << "us";
+				
+				if (result.rate) {
+					output << ", service time p99=" << microseconds(result.service_time.percentile(99)) << "us";
+					
+					if (result.saturated())
+						output << ", saturated";
+					
+					if (result.missed)
+						output << ", " << result.missed << " missed";
+				}
+				
+				if (result.errors)
+					output << ", " << result.errors << " errors";
+				
+				output << std::endl;
+				
+				for (auto & portion : result.breakdown) {
+					output << "  " << std::left << std::setw(10) << portion.first << std::right;
+					
+					for (auto percentile : PERCENTILES) {
+						output << " " << percentile.name << "=" << microseconds(portion.second.percentile(percentile.value)) << "us";
+					}
+					
+					output << std::endl;
+				}
+			}
+			
+			void write_json(std::ostream & output, const Result & result)
+			{
+				auto & configuration = result.configuration;
+				
+				output << std::setprecision(6) << std::fixed;
+				
+				output << "{\"scenario\":\"" << result.scenario << "\"";
+				output << ",\"threads\":" << configuration.threads;
+				output << ",\"concurrency\":" << configuration.concurrency;
+				output << ",\"size\":" << configuration.size;
+				output << ",\"duration\":" << result.duration;
+				output << ",\"operations\":" << result.operations;
+				output << ",\"bytes\":" << result.bytes;
+				output << ",\"errors\":" << result.errors;
+				output << ",\"operations_per_second\":" << result.operations_per_second();
+				output << ",\"bytes_per_second\":" << result.bytes_per_second();
+				
+				output << ",\"latency_ns\":";
+				write_histogram(output, result.latency);
+				
+				if (result.rate) {
+					output << ",\"rate\":" << result.rate;
+					output << ",\"saturated\":" << (result.saturated() ? "true" : "false");
+					output << ",\"missed\":" << result.missed;
+					
+					output << ",\"service_time_ns\":";
+					write_histogram(output, result.service_time);
+				}
+				
+				if (!result.breakdown.empty()) {
+					output << ",\"breakdown_ns\":{";
+					
+					bool first = true;
+					
+					for (auto & portion : result.breakdown) {
+						if (!first) output << ",";
+						first = false;
+						
+						output << "\"" << portion.first << "\":";
+						write_histogram(output, portion.second);
+					}
+					
+					output << "}";
+				}
+				
+				output << ",\"metrics\":{";
+				
+				for (std::size_t index = 0; index < Metrics::COUNTERS; index += 1) {
+					if (index) output << ",";
+					output << "\"" << Metrics::name(Metrics::Counter(index)) << "\":" << result.counters[index];
+				}
+				
+				output << "}}" << std::endl;
+			}
+		}
+	}
+}
+
+using namespace Async::Network::Benchmark;
+
+static void usage(std::ostream & output)
+{
+	output << "Usage: benchmark [options] [scenario...]" << std::endl;
+	output << "\t--threads N       Worker threads for the clients and the server (default 1)." << std::endl;
+	output << "\t--concurrency N   Client fibers per thread (default 8)." << std::endl;
+	output << "\t--duration S      Seconds to run each scenario (default 2)." << std::endl;
+	output << "\t--size BYTES      Request size, or write size for throughput (default 64)." << std::endl;
+	output << "\t--rate R[,R...]   Target requests per second for the load scenario, which runs once per rate to give a latency versus throughput curve." << std::endl;
+	output << "\t--json PATH       Append one JSON object per scenario to PATH, or - for standard output." << std::endl;
+	output << std::endl << "Scenarios (default all):" << std::endl;
+	
+	for (auto & definition : scenarios()) {
+		output << "\t" << std::left << std::setw(18) << definition.name << definition.description << std::endl;
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	// Peers may close connections while the clients are still writing:
+	signal(SIGPIPE, SIG_IGN);
+	
+	Configuration configuration;
+	std::vector<std::string> names;
+	std::string json_path;
+	std::vector<double> rates;
+	
+	try {
+		for (int i = 1; i < argc; i += 1) {
+			std::string argument = argv[i];
+			
+			auto value = [&]() -> std::string {
+				if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + argument);
+				return argv[++i];
+			};
+			
+			if (argument == "--threads") {
+				configuration.threads = std::stoul(value());
+			} else if (argument == "--concurrency") {
+				configuration.concurrency = std::stoul(value());
+			} else if (argument == "--duration") {
+				configuration.duration = std::stod(value());
+			} else if (argument == "--size") {
+				configuration.size = std::stoul(value());
+			} else if (argument == "--rate") {
+				rates = parse_rates(value());
+			} else if (argument == "--json") {
+				json_path = value();
+			} else if (argument == "--help") {
+				usage(std::cout);
+				return 0;
+			} else if (argument.compare(0, 2, "--") == 0) {
+				throw std::invalid_argument("Unknown option " + argument);
+			} else {
+				names.push_back(argument);
+			}
+		}
+		
+		if (configuration.threads == 0 || configuration.concurrency == 0)
+			throw std::invalid_argument("Threads and concurrency must be at least 1!");
+	} catch (std::exception & error) {
+		std::cerr << error.what() << std::endl;
+		usage(std::cerr);
+		return 1;
+	}
+	
+	std::vector<Definition> selected;
+	
+	for (auto & definition : scenarios()) {
+		auto named = std::find(names.begin(), names.end(), definition.name) != names.end();
+		
+		// Open loop scenarios need a rate, so they only run by default if one is given:
+		if (named || (names.empty() && (!definition.open_loop || !rates.empty())))
+			selected.push_back(definition);
+		
+		if (named && definition.open_loop && rates.empty()) {
+			std::cerr << "The " << definition.name << " scenario requires --rate!" << std::endl;
+			return 1;
+		}
+	}
+	
+	if (selected.size() < names.size() || selected.empty()) {
+		std::cerr << "Unknown scenario!" << std::endl;
+		usage(std::cerr);
+		return 1;
+	}
+	
+	std::ofstream json_file;
+	std::ostream * json = nullptr;
+	
+	if (json_path == "-") {
+		json = &std::cout;
+	} else if (!json_path.empty()) {
+		json_file.open(json_path, std::ios::app);
+		json = &json_file;
+	}
+	
+	std::cerr << "threads=" << configuration.threads << " concurrency=" << configuration.concurrency << " duration=" << configuration.duration << "s size=" << configuration.size << std::endl;
+	
+	auto run = [&](const Definition & definition){
+		auto result = definition.scenario(configuration);
+		
+		print(std::cerr, result);
+		
+		if (json) write_json(*json, result);
+	};
+	
+	for (auto & definition : selected) {
+		if (definition.open_loop) {
+			// Each rate is one point on the latency versus throughput curve. Beyond the saturation point, latency grows with the duration of the run:
+			for (auto rate : rates) {
+				configuration.rate = rate;
+				run(definition);
+			}
+		} else {
+			run(definition);
+		}
+	}
+	
+	return 0;
+}
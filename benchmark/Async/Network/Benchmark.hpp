@@ -0,0 +1,129 @@
+//
+//  Benchmark.hpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Async/Network/Histogram.hpp>
+#include <Async/Network/Metrics.hpp>
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <iosfwd>
+
+namespace Async
+{
+	namespace Network
+	{
+		namespace Benchmark
+		{
+			typedef std::chrono::steady_clock Clock;
+			
+			struct Configuration
+			{
+				/// Worker threads, each with its own reactor, for both the clients and the server.
+				std::size_t threads = 1;
+				
+				/// Client fibers per thread, each with its own connection.
+				std::size_t concurrency = 8;
+				
+				/// Seconds to measure each scenario for.
+				double duration = 2.0;
+				
+				/// Bytes per request, or per write for the throughput scenario.
+				std::size_t size = 64;
+				
+				/// Requests per second across all clients, for open loop scenarios.
+				double rate = 0;
+			};
+			
+			/// The combined measurements of all worker threads. Latencies are in nanoseconds.
+			struct Result
+			{
+				std::string scenario;
+				Configuration configuration;
+				
+				std::uint64_t operations = 0;
+				std::uint64_t bytes = 0;
+				std::uint64_t errors = 0;
+				
+				/// The measured wall clock duration, in seconds.
+				double duration = 0;
+				
+				Histogram latency;
+				
+				/// For open loop scenarios, the time from actually sending each request to its response, i.e. latency without the correction for coordinated omission.
+				Histogram service_time;
+				
+				/// Latency split into named portions, e.g. kernel and reactor wakeup time, for scenarios which measure them.
+				std::map<std::string, Histogram> breakdown;
+				
+				/// For open loop scenarios, the target request rate.
+				double rate = 0;
+				
+				/// For open loop scenarios, requests which should have been sent before the run ended but were not, or were still waiting for a response. Each is included in latency, as if it completed when the run ended.
+				std::uint64_t missed = 0;
+				
+				/// Whether an open loop scenario fell short of its target rate by more than 5%, i.e. the server is saturated.
+				bool saturated() const {return rate && operations_per_second() < rate * 0.95;}
+				
+				/// The change in each socket metrics counter while the scenario ran.
+				std::array<std::uint64_t, Metrics::COUNTERS> counters{};
+				
+				double operations_per_second() const {return duration ? operations / duration : 0;}
+				double bytes_per_second() const {return duration ? bytes / duration : 0;}
+			};
+			
+			/// Measurements made by one worker thread.
+			struct Worker
+			{
+				std::uint64_t operations = 0;
+				std::uint64_t bytes = 0;
+				std::uint64_t errors = 0;
+				std::uint64_t missed = 0;
+				
+				Histogram latency;
+				Histogram service_time;
+				
+				std::map<std::string, Histogram> breakdown;
+				
+				/// Record one operation which started at the given time and transferred the given number of bytes.
+				void record(Clock::time_point start, std::size_t size = 0)
+				{
+					operations += 1;
+					bytes += size;
+					
+					latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+				}
+			};
+			
+			typedef Result (*Scenario)(const Configuration & configuration);
+			
+			struct Definition
+			{
+				const char * name;
+				const char * description;
+				Scenario scenario;
+				
+				/// Whether the scenario is run once for each requested rate.
+				bool open_loop = false;
+			};
+			
+			/// All available scenarios, in the order they are run by default.
+			const std::vector<Definition> & scenarios();
+			
+			/// Print a one line summary.
+			void print(std::ostream & output, const Result & result);
+			
+			/// Write a single line JSON object, so that runs can be appended to a file and compared across versions.
+			void write_json(std::ostream & output, const Result & result);
+		}
+	}
+}
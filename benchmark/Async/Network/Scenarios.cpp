@@ -0,0 +1,487 @@
+//
+//  Scenarios.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Benchmark.hpp"
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Acceptor.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Network/ListenerGroup.hpp>
+#include <Async/Network/Timestamping.hpp>
+#include <Async/Reactor.hpp>
+#include <Async/After.hpp>
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <mutex>
+
+namespace Async
+{
+	namespace Network
+	{
+		namespace Benchmark
+		{
+			using Concurrent::Fiber;
+			
+			namespace
+			{
+				typedef std::function<void(Socket & peer, Reactor & reactor)> Handler;
+				
+				// Time for the server to drain connections after the clients stop:
+				const double GRACE = 0.5;
+				
+				/// Accepts connections on the loopback interface using one reactor per thread, and runs the handler for each one in its own fiber. If sharded, each thread is pinned to a CPU and accepts from its own SO_REUSEPORT listener, steered by CPU where supported, rather than all threads sharing one listener.
+				class Server
+				{
+				public:
+					Server(const Configuration & configuration, Handler handler, bool sharded = false) : _group(Endpoint::named_endpoints("127.0.0.1", 0), sharded ? configuration.threads : 1), _handler(handler)
+					{
+						if (sharded) _group.steer_by_cpu();
+						
+						for (std::size_t i = 0; i < configuration.threads; i += 1) {
+							_threads.emplace_back([this, &configuration, sharded, i]{
+								if (sharded) ListenerGroup::pin_current_thread(i % std::thread::hardware_concurrency());
+								
+								Reactor reactor;
+								Fiber::Pool fibers;
+								
+								fibers.resume([&]{
+									Acceptor acceptor(_group.shard(sharded ? i : 0).front(), reactor);
+									
+									while (true) {
+										auto peer = std::make_shared<Socket>(acceptor.accept());
+										
+										fibers.resume([this, peer, &reactor]{
+											try {
+												_handler(*peer, reactor);
+											} catch (std::system_error &) {
+												// The client went away.
+											}
+										});
+									}
+								});
+								
+								reactor.wait(configuration.duration + GRACE);
+							});
+						}
+					}
+					
+					~Server()
+					{
+						for (auto & thread : _threads) thread.join();
+					}
+					
+					Endpoint endpoint() const {return _group.endpoints().front();}
+					
+				private:
+					ListenerGroup _group;
+					Handler _handler;
+					std::vector<std::thread> _threads;
+				};
+				
+				/// A client fiber, given its index out of threads * concurrency.
+				typedef std::function<void(Worker & worker, Reactor & reactor, std::size_t index)> Client;
+				
+				/// Run the client in concurrency fibers on each of the configured threads for the configured duration, and combine the results.
+				Result measure(const char * scenario, const Configuration & configuration, Client client)
+				{
+					Result result;
+					result.scenario = scenario;
+					result.configuration = configuration;
+					
+					std::mutex mutex;
+					std::vector<std::thread> threads;
+					
+					auto before = Metrics::snapshot();
+					auto start = Clock::now();
+					auto end = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(configuration.duration));
+					
+					for (std::size_t i = 0; i < configuration.threads; i += 1) {
+						threads.emplace_back([&, i]{
+							Worker worker;
+							
+							{
+								Reactor reactor;
+								Fiber::Pool fibers;
+								
+								for (std::size_t j = 0; j < configuration.concurrency; j += 1) {
+									auto index = i * configuration.concurrency + j;
+									
+									fibers.resume([&, index]{
+										// A client which fails, e.g. because connect ran out of ephemeral ports, starts again with a new connection, so the concurrency doesn't silently drop for the rest of the run:
+										while (true) {
+											try {
+												client(worker, reactor, index);
+												
+												break;
+											} catch (std::system_error &) {
+												worker.errors += 1;
+											}
+											
+											// Don't spin if the failure is persistent:
+											After(0.001, reactor).wait();
+										}
+									});
+								}
+								
+								// Clients which don't use the reactor may have already used up the duration:
+								std::chrono::duration<double> remaining = end - Clock::now();
+								
+								if (remaining.count() > 0)
+									reactor.wait(remaining.count());
+							}
+							
+							std::lock_guard<std::mutex> guard(mutex);
+							
+							result.operations += worker.operations;
+							result.bytes += worker.bytes;
+							result.errors += worker.errors;
+							result.missed += worker.missed;
+							result.latency += worker.latency;
+							result.service_time += worker.service_time;
+							
+							for (auto & portion : worker.breakdown)
+								result.breakdown[portion.first] += portion.second;
+						});
+					}
+					
+					for (auto & thread : threads) thread.join();
+					
+					result.duration = std::chrono::duration<double>(Clock::now() - start).count();
+					
+					auto after = Metrics::snapshot();
+					
+					for (std::size_t index = 0; index < result.counters.size(); index += 1)
+						result.counters[index] = after.counters[index] - before.counters[index];
+					
+					return result;
+				}
+				
+				void receive_exactly(Socket & socket, char * buffer, std::size_t size, Reactor & reactor)
+				{
+					while (size > 0) {
+						auto result = socket.receive(buffer, size, reactor);
+						
+						if (result == 0)
+							throw std::system_error(ECONNRESET, std::generic_category(), "receive");
+						
+						buffer += result;
+						size -= result;
+					}
+				}
+				
+				// Connect, which the server accepts and closes. Measures the connection rate, and the latency of connect.
+				Result measure_connections(const char * scenario, const Configuration & configuration, bool sharded)
+				{
+					Server server(configuration, [](Socket &, Reactor &){}, sharded);
+					auto endpoint = server.endpoint();
+					
+					return measure(scenario, configuration, [&](Worker & worker, Reactor & reactor, std::size_t){
+						while (true) {
+							auto start = Clock::now();
+							auto socket = endpoint.connect(reactor);
+							
+							worker.record(start);
+						}
+					});
+				}
+				
+				Result connection_rate(const Configuration & configuration)
+				{
+					return measure_connections("connect", configuration, false);
+				}
+				
+				// As connect, with one listener per server thread. Compare with connect using the same --threads to see whether sharding improves the accept rate.
+				Result sharded_connection_rate(const Configuration & configuration)
+				{
+					return measure_connections("connect-sharded", configuration, true);
+				}
+				
+				// Round trips of one byte between a pair of UNIX domain sockets on the client's own reactor, so every receive waits. If attached, both sockets are registered with the reactor once, rather than added and removed on every wait. Compare the round trips and waits of pair and pair-attached to see what a persistent registration saves per wait.
+				Result measure_pairs(const char * scenario, const Configuration & configuration, bool attached)
+				{
+					return measure(scenario, configuration, [attached](Worker & worker, Reactor & reactor, std::size_t){
+						auto sockets = Socket::pair();
+						
+						if (attached) {
+							sockets.first.attach(reactor);
+							sockets.second.attach(reactor);
+						}
+						
+						Fiber::Pool fibers;
+						
+						fibers.resume([&]{
+							char byte;
+							
+							while (sockets.second.receive(&byte, 1, reactor)) {
+								sockets.second.send(&byte, 1, reactor);
+							}
+						});
+						
+						char byte = 'x';
+						
+						while (true) {
+							auto start = Clock::now();
+							
+							sockets.first.send(&byte, 1, reactor);
+							receive_exactly(sockets.first, &byte, 1, reactor);
+							
+							worker.record(start, 2);
+						}
+					});
+				}
+				
+				Result pairs(const Configuration & configuration)
+				{
+					return measure_pairs("pair", configuration, false);
+				}
+				
+				Result attached_pairs(const Configuration & configuration)
+				{
+					return measure_pairs("pair-attached", configuration, true);
+				}
+				
+				// Send a request of the given size on a persistent connection, and wait for the server to echo it back.
+				Result echo(const Configuration & configuration)
+				{
+					auto size = configuration.size;
+					
+					Server server(configuration, [size](Socket & peer, Reactor & reactor){
+						std::vector<char> buffer(size);
+						
+						while (true) {
+							receive_exactly(peer, buffer.data(), size, reactor);
+							peer.send(buffer.data(), size, reactor);
+						}
+					});
+					
+					auto endpoint = server.endpoint();
+					
+					return measure("echo", configuration, [&](Worker & worker, Reactor & reactor, std::size_t){
+						auto socket = endpoint.connect(reactor);
+						std::vector<char> buffer(size, 'x');
+						
+						while (true) {
+							auto start = Clock::now();
+							
+							socket.send(buffer.data(), size, reactor);
+							receive_exactly(socket, buffer.data(), size, reactor);
+							
+							worker.record(start, size * 2);
+						}
+					});
+				}
+				
+				// Write as fast as possible while the server discards. Measures bytes per second, and the latency of each write, which includes waiting for the socket buffer to drain.
+				Result throughput(const Configuration & configuration)
+				{
+					auto size = configuration.size;
+					
+					Server server(configuration, [](Socket & peer, Reactor & reactor){
+						std::vector<char> buffer(256 * 1024);
+						
+						while (peer.receive(buffer.data(), buffer.size(), reactor) > 0);
+					});
+					
+					auto endpoint = server.endpoint();
+					
+					return measure("throughput", configuration, [&](Worker & worker, Reactor & reactor, std::size_t){
+						auto socket = endpoint.connect(reactor);
+						std::vector<char> buffer(size, 'x');
+						
+						while (true) {
+							auto start = Clock::now();
+							
+							socket.send(buffer.data(), size, reactor);
+							
+							worker.record(start, size);
+						}
+					});
+				}
+				
+				// Create and close sockets. No reactor is involved, so each thread runs a single loop regardless of concurrency.
+				Result allocation(const Configuration & configuration)
+				{
+					auto single = configuration;
+					single.concurrency = 1;
+					
+					return measure("allocation", single, [&](Worker & worker, Reactor &, std::size_t){
+						auto end = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(configuration.duration));
+						
+						while (Clock::now() < end) {
+							auto start = Clock::now();
+							
+							{
+								Socket socket(AF_INET, SOCK_STREAM);
+							}
+							
+							worker.record(start);
+						}
+					});
+				}
+				
+				// Echo as above, using kernel timestamps to split each round trip into the time the kernel took to send the request, the time until the response was received by the kernel (loopback and the server), and the time until the client fiber had the response (reactor wakeup).
+				Result timestamps(const Configuration & configuration)
+				{
+					auto size = configuration.size;
+					
+					Server server(configuration, [size](Socket & peer, Reactor & reactor){
+						std::vector<char> buffer(size);
+						
+						while (true) {
+							receive_exactly(peer, buffer.data(), size, reactor);
+							peer.send(buffer.data(), size, reactor);
+						}
+					});
+					
+					auto endpoint = server.endpoint();
+					
+					return measure("timestamps", configuration, [&](Worker & worker, Reactor & reactor, std::size_t){
+						auto socket = endpoint.connect(reactor);
+						Timestamping timestamping(socket, reactor);
+						
+						if (!timestamping.enabled())
+							throw std::system_error(ENOTSUP, std::generic_category(), "SO_TIMESTAMPING");
+						
+						std::vector<char> buffer(size, 'x');
+						
+						auto & kernel_send = worker.breakdown["kernel_send"];
+						auto & in_flight = worker.breakdown["in_flight"];
+						auto & wakeup = worker.breakdown["wakeup"];
+						
+						while (true) {
+							auto start = Clock::now();
+							auto sending = Timestamping::now();
+							
+							auto identifier = timestamping.send(buffer.data(), size);
+							
+							// Only the first part of the response needs a timestamp:
+							Timestamping::Nanoseconds received;
+							auto offset = timestamping.receive(buffer.data(), size, received);
+							auto woken = Timestamping::now();
+							
+							receive_exactly(socket, buffer.data() + offset, size - offset, reactor);
+							
+							worker.record(start, size * 2);
+							
+							timestamping.collect();
+							
+							Timestamping::Completion completion;
+							
+							while (timestamping.pop(completion)) {
+								if (completion.identifier != identifier || completion.stage != Timestamping::SENT || !received)
+									continue;
+								
+								// The realtime clock may be adjusted while running:
+								if (sending <= completion.time && completion.time <= received && received <= woken) {
+									kernel_send.record(completion.time - sending);
+									in_flight.record(received - completion.time);
+									wakeup.record(woken - received);
+								}
+							}
+						}
+					});
+				}
+				
+				// Send requests at a fixed total rate, regardless of how long responses take, as a real client population would. Latency is measured from when each request should have been sent rather than when it was, so that a stalled server is charged for the requests it delayed (coordinated omission).
+				Result open_loop(const Configuration & configuration)
+				{
+					auto size = configuration.size;
+					
+					Server server(configuration, [size](Socket & peer, Reactor & reactor){
+						std::vector<char> buffer(size);
+						
+						while (true) {
+							receive_exactly(peer, buffer.data(), size, reactor);
+							peer.send(buffer.data(), size, reactor);
+						}
+					});
+					
+					auto endpoint = server.endpoint();
+					
+					auto clients = configuration.threads * configuration.concurrency;
+					auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(clients / configuration.rate));
+					auto start = Clock::now();
+					auto end = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(configuration.duration));
+					
+					// The time each client should send its next request. Stagger the clients evenly across the interval, so the requests are not sent in bursts:
+					std::vector<Clock::time_point> schedule(clients);
+					
+					for (std::size_t index = 0; index < clients; index += 1)
+						schedule[index] = start + std::chrono::duration_cast<Clock::duration>((interval * index) / clients);
+					
+					auto result = measure("load", configuration, [&](Worker & worker, Reactor & reactor, std::size_t index){
+						// A client which failed and was restarted continues its schedule, so requests it missed while reconnecting are charged:
+						auto & intended = schedule[index];
+						
+						// When the client is stopped at the end of the run, every request which should have been sent by then, including one still waiting for its response, is charged until the end. Otherwise the worst latencies past saturation would be omitted:
+						struct Missed {
+							Worker & worker;
+							Clock::time_point & intended;
+							Clock::time_point end;
+							Clock::duration interval;
+							
+							~Missed() {
+								// A client which failed during the run is restarted, and catches up by itself:
+								if (Clock::now() < end) return;
+								
+								for (; intended < end; intended += interval) {
+									worker.missed += 1;
+									worker.latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - intended).count());
+								}
+							}
+						} missed{worker, intended, end, interval};
+						
+						auto socket = endpoint.connect(reactor);
+						std::vector<char> buffer(size, 'x');
+						
+						while (true) {
+							std::chrono::duration<double> delay = intended - Clock::now();
+							
+							// A client which has fallen behind sends immediately, and its latency includes the time it spent behind:
+							if (delay.count() > 0)
+								After(delay.count(), reactor).wait();
+							
+							auto sent = Clock::now();
+							
+							socket.send(buffer.data(), size, reactor);
+							receive_exactly(socket, buffer.data(), size, reactor);
+							
+							worker.record(intended, size * 2);
+							worker.service_time.record(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - sent).count());
+							
+							intended += interval;
+						}
+					});
+					
+					result.rate = configuration.rate;
+					
+					return result;
+				}
+			}
+			
+			const std::vector<Definition> & scenarios()
+			{
+				static const std::vector<Definition> SCENARIOS = {
+					{"connect", "Connections per second, and the latency of connect.", connection_rate},
+					{"connect-sharded", "Connect, with one SO_REUSEPORT listener per server thread, steered by CPU.", sharded_connection_rate},
+					{"echo", "Request and response round trips on persistent connections.", echo},
+					{"pair", "Round trips between a pair of UNIX domain sockets, waiting with a temporary monitor.", pairs},
+					{"pair-attached", "Pair, with both sockets registered with the reactor once (Socket::attach).", attached_pairs},
+					{"throughput", "Bulk transfer in writes of the given size.", throughput},
+					{"allocation", "Creating and closing sockets.", allocation},
+					{"timestamps", "Echo, split into kernel send, in flight and reactor wakeup time using SO_TIMESTAMPING.", timestamps},
+					{"load", "Echo requests at each --rate, with latency corrected for coordinated omission.", open_loop, true},
+				};
+				
+				return SCENARIOS;
+			}
+		}
+	}
+}
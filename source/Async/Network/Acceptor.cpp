@@ -0,0 +1,62 @@
+//
+//  Acceptor.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Acceptor.hpp"
+
+#include <stdexcept>
+
+namespace Async
+{
+	namespace Network
+	{
+		Acceptor::Acceptor(const Socket & socket, Reactor & reactor, std::size_t batch_size, const SocketOptions & options) : _socket(socket), _event(socket, reactor), _batch_size(batch_size), _options(options)
+		{
+			if (_batch_size == 0)
+				throw std::invalid_argument("Batch size must be at least 1!");
+		}
+		
+		Acceptor::~Acceptor()
+		{
+		}
+		
+		std::size_t Acceptor::accept_batch(const Socket::AcceptCallback & callback)
+		{
+			while (true) {
+				std::size_t count;
+				
+				if (_options.empty()) {
+					count = _socket.accept_pending(callback, _batch_size);
+				} else {
+					count = _socket.accept_pending([&](Socket && peer){
+						_options.apply_accepted(peer);
+						callback(std::move(peer));
+					}, _batch_size);
+				}
+				
+				if (count > 0) return count;
+				
+				_waits += 1;
+				_event.wait();
+			}
+		}
+		
+		Socket Acceptor::accept()
+		{
+			if (_queue.empty()) {
+				accept_batch([this](Socket && peer){
+					_queue.push_back(std::move(peer));
+				});
+			}
+			
+			auto peer = std::move(_queue.front());
+			_queue.pop_front();
+			
+			return peer;
+		}
+	}
+}
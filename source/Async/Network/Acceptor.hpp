@@ -0,0 +1,59 @@
+//
+//  Acceptor.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Socket.hpp"
+#include "SocketOptions.hpp"
+
+#include <Async/Readable.hpp>
+
+#include <deque>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Accepts connections from a listening socket in batches. The listener stays registered with the reactor for the lifetime of the acceptor, and each readiness wakeup drains up to batch_size pending connections.
+		class Acceptor
+		{
+		public:
+			/// Accepted connections have the given options applied, if they are not inherited from the listening socket.
+			Acceptor(const Socket & socket, Reactor & reactor, std::size_t batch_size = 64, const SocketOptions & options = SocketOptions());
+			~Acceptor();
+			
+			Acceptor(const Acceptor &) = delete;
+			Acceptor & operator=(const Acceptor &) = delete;
+			
+			const Socket & socket() const {return _socket;}
+			std::size_t batch_size() const {return _batch_size;}
+			
+			/// Wait until at least one connection is pending, then pass up to batch_size connections to the callback. Returns the number accepted.
+			std::size_t accept_batch(const Socket::AcceptCallback & callback);
+			
+			/// Return the next connection, from the internal queue if possible, otherwise by accepting another batch.
+			Socket accept();
+			
+			/// Connections accepted but not yet returned by accept().
+			std::size_t queued() const {return _queue.size();}
+			
+			/// The number of times the acceptor waited on the reactor.
+			std::size_t waits() const {return _waits;}
+			
+		private:
+			const Socket & _socket;
+			Readable _event;
+			
+			std::size_t _batch_size;
+			SocketOptions _options;
+			std::size_t _waits = 0;
+			
+			std::deque<Socket> _queue;
+		};
+	}
+}
@@ -10,12 +10,19 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <net/if.h>
 #include <netdb.h>
 
 #include <sstream>
 #include <cassert>
 #include <cstring>
+#include <cstddef>
+#include <cstdint>
 #include <system_error>
+#include <stdexcept>
 
 #include <iostream>
 
@@ -64,6 +71,13 @@ namespace Async
 			_size = size;
 		}
 		
+		void Address::resize(std::size_t size)
+		{
+			assert(size <= sizeof(_data));
+			
+			_size = size;
+		}
+		
 		int Address::name_info_for_address(std::string * name, std::string * service, int flags) const
 		{
 			char * name_buffer = nullptr, * service_buffer = nullptr;
@@ -95,6 +109,13 @@ namespace Async
 		
 		Port Address::port() const
 		{
+			// The port can be read directly for the common families, without a call to getnameinfo:
+			if (family() == AF_INET) {
+				return ntohs(reinterpret_cast<const sockaddr_in *>(&_data)->sin_port);
+			} else if (family() == AF_INET6) {
+				return ntohs(reinterpret_cast<const sockaddr_in6 *>(&_data)->sin6_port);
+			}
+			
 			std::string port_string;
 
 			auto error = name_info_for_address(nullptr, &port_string, NI_NUMERICSERV);
@@ -106,6 +127,17 @@ namespace Async
 			return std::stoi(port_string);
 		}
 
+		void Address::set_port(Port port)
+		{
+			if (family() == AF_INET) {
+				reinterpret_cast<sockaddr_in *>(&_data)->sin_port = htons(port);
+			} else if (family() == AF_INET6) {
+				reinterpret_cast<sockaddr_in6 *>(&_data)->sin6_port = htons(port);
+			} else {
+				throw std::invalid_argument("Address family does not have a port!");
+			}
+		}
+		
 		std::string Address::service_name(bool numeric) const
 		{
 			std::string port_string;
@@ -115,6 +147,10 @@ namespace Async
 				error = name_info_for_address(nullptr, &port_string, NI_NAMEREQD);
 			}
 			
+			if (numeric && (family() == AF_INET || family() == AF_INET6)) {
+				return std::to_string(port());
+			}
+			
 			if (error == EAI_NONAME || numeric) {
 				error = name_info_for_address(nullptr, &port_string, NI_NUMERICSERV);
 			}
@@ -130,12 +166,22 @@ namespace Async
 		{
 			std::string host_string;
 			
+			// UNIX domain addresses have no host, and getnameinfo does not support them:
+			if (family() == AF_UNIX) return unix_path();
+			
 			int error = 0;
 			
 			if (!numeric) {
 				error = name_info_for_address(&host_string, nullptr, NI_NAMEREQD);
 			}
 			
+			if (numeric) {
+				char buffer[numeric_capacity()];
+				
+				if (format_host(buffer, sizeof(buffer)))
+					return buffer;
+			}
+			
 			if (error == EAI_NONAME || numeric) {
 				error = name_info_for_address(&host_string, nullptr, NI_NUMERICHOST);
 			}
@@ -147,8 +193,265 @@ namespace Async
 			return host_string;
 		}
 		
+		const char * Address::format_host(char * buffer, std::size_t size) const
+		{
+			if (family() == AF_INET) {
+				return ::inet_ntop(AF_INET, &reinterpret_cast<const sockaddr_in *>(&_data)->sin_addr, buffer, size);
+			} else if (family() == AF_INET6) {
+				auto address = reinterpret_cast<const sockaddr_in6 *>(&_data);
+				
+				if (!::inet_ntop(AF_INET6, &address->sin6_addr, buffer, size)) return nullptr;
+				
+				// A link-local address is ambiguous without its interface, e.g. "fe80::1%2". The index is used rather than the name, so formatting needs no system call:
+				if (auto scope = address->sin6_scope_id) {
+					char digits[10];
+					std::size_t count = 0;
+					
+					do {
+						digits[count++] = '0' + scope % 10;
+						scope /= 10;
+					} while (scope > 0);
+					
+					auto length = std::strlen(buffer);
+					
+					if (length + 1 + count + 1 > size) return nullptr;
+					
+					buffer[length++] = '%';
+					
+					while (count > 0) {
+						buffer[length++] = digits[--count];
+					}
+					
+					buffer[length] = '\0';
+				}
+				
+				return buffer;
+			}
+			
+			return nullptr;
+		}
+		
+		std::size_t Address::format_numeric(char * buffer, std::size_t size) const
+		{
+			// Leave room for the brackets of an IPv6 address:
+			if (size < 2 || !format_host(buffer + 1, size - 1)) return 0;
+			
+			std::size_t length;
+			
+			if (family() == AF_INET6) {
+				buffer[0] = '[';
+				length = 1 + std::strlen(buffer + 1);
+				
+				if (length + 1 >= size) return 0;
+				buffer[length++] = ']';
+			} else {
+				length = std::strlen(buffer + 1);
+				std::memmove(buffer, buffer + 1, length);
+			}
+			
+			// Format the port in reverse, then copy it after the separator:
+			char digits[5];
+			std::size_t count = 0;
+			unsigned port = this->port();
+			
+			do {
+				digits[count++] = '0' + port % 10;
+				port /= 10;
+			} while (port > 0);
+			
+			if (length + 1 + count + 1 > size) return 0;
+			
+			buffer[length++] = ':';
+			
+			while (count > 0) {
+				buffer[length++] = digits[--count];
+			}
+			
+			buffer[length] = '\0';
+			
+			return length;
+		}
+		
+		namespace
+		{
+			bool parse_port(const char * text, const char * end, Port & port)
+			{
+				if (text == end || end - text > 5) return false;
+				
+				unsigned value = 0;
+				
+				for (; text != end; text += 1) {
+					if (*text < '0' || *text > '9') return false;
+					
+					value = value * 10 + (*text - '0');
+				}
+				
+				if (value > 65535) return false;
+				
+				port = value;
+				
+				return true;
+			}
+			
+			// An interface index, or name, following the "%" of a scoped IPv6 address.
+			bool parse_scope(const char * text, const char * end, std::uint32_t & scope)
+			{
+				if (text == end || end - text >= IF_NAMESIZE) return false;
+				
+				if (*text >= '0' && *text <= '9') {
+					std::uint64_t value = 0;
+					
+					for (; text != end; text += 1) {
+						if (*text < '0' || *text > '9') return false;
+						
+						value = value * 10 + (*text - '0');
+						
+						if (value > 0xFFFFFFFF) return false;
+					}
+					
+					scope = value;
+				} else {
+					char name[IF_NAMESIZE];
+					std::memcpy(name, text, end - text);
+					name[end - text] = '\0';
+					
+					scope = ::if_nametoindex(name);
+				}
+				
+				return scope != 0;
+			}
+		}
+		
+		bool Address::parse_numeric(const char * text, std::size_t size, Address & address)
+		{
+			const char * end = text + size;
+			const char * host = text, * host_end = end;
+			Port port = 0;
+			
+			if (size > 0 && text[0] == '[') {
+				// "[host]" or "[host]:port":
+				host += 1;
+				host_end = static_cast<const char *>(std::memchr(host, ']', end - host));
+				
+				if (!host_end) return false;
+				
+				if (host_end + 1 != end) {
+					if (host_end[1] != ':' || !parse_port(host_end + 2, end, port))
+						return false;
+				}
+			} else {
+				// A single colon separates an IPv4 host and port, while more than one means an IPv6 host without a port:
+				auto colon = static_cast<const char *>(std::memchr(text, ':', size));
+				
+				if (colon && !std::memchr(colon + 1, ':', end - colon - 1)) {
+					if (!parse_port(colon + 1, end, port))
+						return false;
+					
+					host_end = colon;
+				}
+			}
+			
+			std::uint32_t scope = 0;
+			
+			if (auto percent = static_cast<const char *>(std::memchr(host, '%', host_end - host))) {
+				if (!parse_scope(percent + 1, host_end, scope))
+					return false;
+				
+				host_end = percent;
+			}
+			
+			// inet_pton requires a null terminated string:
+			char buffer[INET6_ADDRSTRLEN];
+			std::size_t length = host_end - host;
+			
+			if (length == 0 || length >= sizeof(buffer)) return false;
+			
+			std::memcpy(buffer, host, length);
+			buffer[length] = '\0';
+			
+			sockaddr_in address4 = {};
+			sockaddr_in6 address6 = {};
+			
+			if (scope == 0 && ::inet_pton(AF_INET, buffer, &address4.sin_addr) == 1) {
+				address4.sin_family = AF_INET;
+				address4.sin_port = htons(port);
+				
+				address.set(reinterpret_cast<sockaddr *>(&address4), sizeof(address4));
+			} else if (::inet_pton(AF_INET6, buffer, &address6.sin6_addr) == 1) {
+				address6.sin6_family = AF_INET6;
+				address6.sin6_port = htons(port);
+				address6.sin6_scope_id = scope;
+				
+				address.set(reinterpret_cast<sockaddr *>(&address6), sizeof(address6));
+			} else {
+				return false;
+			}
+			
+			return true;
+		}
+		
+		Address Address::parse_numeric(const std::string & text)
+		{
+			Address address;
+			
+			if (!parse_numeric(text.data(), text.size(), address))
+				throw std::invalid_argument("Not a numeric address: " + text);
+			
+			return address;
+		}
+		
+		Address Address::unix_domain(const std::string & path)
+		{
+			sockaddr_un address = {};
+			address.sun_family = AF_UNIX;
+			
+			// The path is null terminated, while an abstract name is the bytes after a leading null. An empty path is an unnamed address, which binds to an automatically chosen abstract name:
+			if (path.size() >= sizeof(address.sun_path))
+				throw std::invalid_argument("UNIX domain path is too long: " + path);
+			
+			std::memcpy(address.sun_path, path.data(), path.size());
+			std::size_t size = offsetof(sockaddr_un, sun_path) + path.size();
+			
+			if (!path.empty() && path.front() == '@') {
+				address.sun_path[0] = '\0';
+			} else if (!path.empty()) {
+				size += 1;
+			}
+			
+			return Address(reinterpret_cast<sockaddr *>(&address), size);
+		}
+		
+		std::string Address::unix_path() const
+		{
+			if (family() != AF_UNIX)
+				throw std::invalid_argument("Address family is not AF_UNIX!");
+			
+			auto address = reinterpret_cast<const sockaddr_un *>(&_data);
+			auto offset = offsetof(sockaddr_un, sun_path);
+			
+			if (_size <= offset) return std::string();
+			
+			std::size_t length = _size - offset;
+			
+			if (address->sun_path[0] == '\0') {
+				return '@' + std::string(address->sun_path + 1, length - 1);
+			}
+			
+			return std::string(address->sun_path, strnlen(address->sun_path, length));
+		}
+		
 		std::ostream & operator<<(std::ostream & output, const Address & address)
 		{
+			char buffer[Address::numeric_capacity()];
+			
+			if (auto length = address.format_numeric(buffer, sizeof(buffer))) {
+				return output.write(buffer, length);
+			}
+			
+			if (address.family() == AF_UNIX) {
+				return output << "unix:" << address.unix_path();
+			}
+			
 			if (address.family() == AF_INET6) {
 				output << '[' << address.canonical_name() << "]:";
 			} else {
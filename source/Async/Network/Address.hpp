@@ -17,13 +17,16 @@ namespace Async
 {
 	namespace Network
 	{
-		/// AF_INET, AF_INET6
+		/// AF_INET, AF_INET6, AF_UNIX
 		typedef int AddressFamily;
 		
 		// A container for sockaddr
 		class Address
 		{
 		public:
+			/// An empty address, typically filled in by a system call using data() and resize().
+			Address() {}
+			
 			/// Construct from another address and a <tt>sockaddr *</tt>. This is used when receiving a connection, for example, from the bind system call.
 			Address(const struct sockaddr * data, std::size_t size);
 			~Address();
@@ -45,10 +48,19 @@ namespace Async
 			const sockaddr * data() const {return reinterpret_cast<const sockaddr *>(&_data);}
 			std::size_t size() const {return _size;}
 			
+			/// The maximum size of the sockaddr which can be stored.
+			static constexpr std::size_t capacity() {return sizeof(sockaddr_storage);}
+			
+			/// Update the size after data() has been written to directly.
+			void resize(std::size_t size);
+			
 			AddressFamily family() const noexcept {return _data.ss_family;}
 			
 			/// The port number if it is applicable.
 			Port port() const;
+			
+			/// Set the port number of an IPv4 or IPv6 address.
+			void set_port(Port port);
 
 			/// The service name if it is applicable. Retrieved from /etc/services based on the port number.
 			std::string service_name(bool numeric = true) const;
@@ -56,9 +68,30 @@ namespace Async
 			/// Typically returns the hostname if one is available, otherwise returns the numeric address.
 			std::string canonical_name(bool numeric = true) const;
 			
+			/// The buffer size which is always sufficient for format_numeric, e.g. "[ffff:...:ffff%4294967295]:65535".
+			static constexpr std::size_t numeric_capacity() {return 80;}
+			
+			/// Write the numeric "host:port" form, or "[host]:port" for IPv6, into the buffer without allocating. A scoped IPv6 address includes its interface index, e.g. "[fe80::1%2]:80". The result is null terminated. Returns its length, or 0 if the buffer is too small or the address is not IPv4 or IPv6.
+			std::size_t format_numeric(char * buffer, std::size_t size) const;
+			
+			/// Parse a numeric address of the form "1.2.3.4:80", "[::1]:80", "1.2.3.4" or "::1" without allocating. An IPv6 address may have a scope, given as an interface index or name, e.g. "[fe80::1%eth0]:80". A missing port is 0. Returns false if the text is not a numeric address.
+			static bool parse_numeric(const char * text, std::size_t size, Address & address);
+			
+			/// Parse a numeric address, throwing std::invalid_argument if the text is not one.
+			static Address parse_numeric(const std::string & text);
+			
+			/// A UNIX domain address for the given filesystem path, or for a name in the abstract namespace (Linux) if the path starts with "@". Throws std::invalid_argument if the path is too long.
+			static Address unix_domain(const std::string & path);
+			
+			/// The path of a UNIX domain address, "@name" for an abstract name, or empty for an unnamed socket, e.g. one end of a socket pair.
+			std::string unix_path() const;
+			
 		private:
 			int name_info_for_address(std::string * name, std::string * service, int flags) const;
 			
+			/// Write the numeric host of an IPv4 or IPv6 address, returning nullptr for other families.
+			const char * format_host(char * buffer, std::size_t size) const;
+			
 			int compare(const Address & other) const noexcept;
 			
 			/// Address data(sockaddr)
@@ -0,0 +1,177 @@
+//
+//  AddressMap.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "CompactAddress.hpp"
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A flat hash map keyed by compact address, using open addressing with linear probing. Keys and values are stored inline in a single array, and an empty key marks an empty slot, so there is no per-entry allocation or metadata. Pointers to values are invalidated by insertion and erasure.
+		template <typename ValueT>
+		class AddressMap
+		{
+		public:
+			typedef CompactAddress Key;
+			typedef ValueT Value;
+			
+			struct Slot
+			{
+				Key key;
+				Value value;
+			};
+			
+			AddressMap(std::size_t capacity = 0)
+			{
+				reserve(capacity);
+			}
+			
+			std::size_t size() const noexcept {return _size;}
+			bool empty() const noexcept {return _size == 0;}
+			
+			/// The number of slots, which is always a power of two.
+			std::size_t capacity() const noexcept {return _slots.size();}
+			
+			/// The memory used by the slots.
+			std::size_t memory() const noexcept {return _slots.size() * sizeof(Slot);}
+			
+			/// Ensure that count entries can be stored without growing.
+			void reserve(std::size_t count)
+			{
+				std::size_t capacity = 16;
+				
+				while (capacity * MAXIMUM_LOAD_NUMERATOR < count * MAXIMUM_LOAD_DENOMINATOR) capacity *= 2;
+				
+				if (capacity > _slots.size()) rehash(capacity);
+			}
+			
+			Value * find(const Key & key) noexcept
+			{
+				if (_slots.empty()) return nullptr;
+				
+				for (auto index = key.hash() & mask(); !_slots[index].key.empty(); index = (index + 1) & mask()) {
+					if (_slots[index].key == key) return &_slots[index].value;
+				}
+				
+				return nullptr;
+			}
+			
+			const Value * find(const Key & key) const noexcept
+			{
+				return const_cast<AddressMap *>(this)->find(key);
+			}
+			
+			/// Return the value for the key, inserting a default constructed value if it does not exist.
+			Value & operator[](const Key & key)
+			{
+				return insert(key, Value()).first;
+			}
+			
+			/// Insert the value if the key does not exist. Returns the value for the key, and whether it was inserted.
+			std::pair<Value &, bool> insert(const Key & key, Value value)
+			{
+				if (key.empty())
+					throw std::invalid_argument("Cannot insert an empty address!");
+				
+				if ((_size + 1) * MAXIMUM_LOAD_DENOMINATOR > _slots.size() * MAXIMUM_LOAD_NUMERATOR)
+					rehash(_slots.empty() ? 16 : _slots.size() * 2);
+				
+				auto index = key.hash() & mask();
+				
+				for (; !_slots[index].key.empty(); index = (index + 1) & mask()) {
+					if (_slots[index].key == key) return {_slots[index].value, false};
+				}
+				
+				_slots[index].key = key;
+				_slots[index].value = std::move(value);
+				_size += 1;
+				
+				return {_slots[index].value, true};
+			}
+			
+			/// Remove the key if it exists. Entries later in the same probe sequence are shifted back, so no tombstones are needed and lookups stay short.
+			bool erase(const Key & key)
+			{
+				if (_slots.empty()) return false;
+				
+				auto index = key.hash() & mask();
+				
+				while (!(_slots[index].key == key)) {
+					if (_slots[index].key.empty()) return false;
+					
+					index = (index + 1) & mask();
+				}
+				
+				auto next = (index + 1) & mask();
+				
+				while (!_slots[next].key.empty()) {
+					auto home = _slots[next].key.hash() & mask();
+					
+					// Move the entry into the hole if the hole lies between its home slot and its current slot:
+					if (((next - home) & mask()) >= ((next - index) & mask())) {
+						_slots[index] = std::move(_slots[next]);
+						index = next;
+					}
+					
+					next = (next + 1) & mask();
+				}
+				
+				_slots[index] = Slot();
+				_size -= 1;
+				
+				return true;
+			}
+			
+			void clear()
+			{
+				for (auto & slot : _slots) slot = Slot();
+				
+				_size = 0;
+			}
+			
+			/// Invoke the callback with the key and value of every entry, in no particular order.
+			template <typename CallbackT>
+			void each(CallbackT callback)
+			{
+				for (auto & slot : _slots) {
+					if (!slot.key.empty()) callback(slot.key, slot.value);
+				}
+			}
+			
+		private:
+			static constexpr std::size_t MAXIMUM_LOAD_NUMERATOR = 3, MAXIMUM_LOAD_DENOMINATOR = 4;
+			
+			std::size_t mask() const noexcept {return _slots.size() - 1;}
+			
+			void rehash(std::size_t capacity)
+			{
+				std::vector<Slot> slots(capacity);
+				std::swap(slots, _slots);
+				
+				for (auto & slot : slots) {
+					if (slot.key.empty()) continue;
+					
+					auto index = slot.key.hash() & mask();
+					
+					while (!_slots[index].key.empty()) index = (index + 1) & mask();
+					
+					_slots[index] = std::move(slot);
+				}
+			}
+			
+			std::vector<Slot> _slots;
+			std::size_t _size = 0;
+		};
+	}
+}
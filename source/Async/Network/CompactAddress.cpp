@@ -0,0 +1,72 @@
+//
+//  CompactAddress.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "CompactAddress.hpp"
+
+#include <netinet/in.h>
+
+#include <stdexcept>
+#include <ostream>
+
+namespace Async
+{
+	namespace Network
+	{
+		CompactAddress::CompactAddress(const Address & address)
+		{
+			if (address.family() == AF_INET && address.size() >= sizeof(sockaddr_in)) {
+				auto data = reinterpret_cast<const sockaddr_in *>(address.data());
+				
+				std::memcpy(_bytes, &data->sin_addr, sizeof(data->sin_addr));
+				_port = ntohs(data->sin_port);
+			} else if (address.family() == AF_INET6 && address.size() >= sizeof(sockaddr_in6)) {
+				auto data = reinterpret_cast<const sockaddr_in6 *>(address.data());
+				
+				std::memcpy(_bytes, &data->sin6_addr, sizeof(data->sin6_addr));
+				_scope = data->sin6_scope_id;
+				_port = ntohs(data->sin6_port);
+			} else {
+				throw std::invalid_argument("Address is not IPv4 or IPv6!");
+			}
+			
+			_family = address.family();
+		}
+		
+		bool CompactAddress::is_compact(const Address & address) noexcept
+		{
+			return (address.family() == AF_INET && address.size() >= sizeof(sockaddr_in)) || (address.family() == AF_INET6 && address.size() >= sizeof(sockaddr_in6));
+		}
+		
+		Address CompactAddress::address() const
+		{
+			if (_family == AF_INET) {
+				sockaddr_in data = {};
+				data.sin_family = AF_INET;
+				data.sin_port = htons(_port);
+				std::memcpy(&data.sin_addr, _bytes, sizeof(data.sin_addr));
+				
+				return Address(reinterpret_cast<sockaddr *>(&data), sizeof(data));
+			} else if (_family == AF_INET6) {
+				sockaddr_in6 data = {};
+				data.sin6_family = AF_INET6;
+				data.sin6_port = htons(_port);
+				data.sin6_scope_id = _scope;
+				std::memcpy(&data.sin6_addr, _bytes, sizeof(data.sin6_addr));
+				
+				return Address(reinterpret_cast<sockaddr *>(&data), sizeof(data));
+			}
+			
+			return Address();
+		}
+		
+		std::ostream & operator<<(std::ostream & output, const CompactAddress & address)
+		{
+			return output << address.address();
+		}
+	}
+}
@@ -0,0 +1,85 @@
+//
+//  CompactAddress.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Address.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// An IPv4 or IPv6 address and port in 24 bytes, for tables keyed by peer. IPv4 addresses are stored in the first 4 bytes of the address. The IPv6 scope is kept, but not the flow label, which is not part of a peer's identity.
+		class CompactAddress
+		{
+		public:
+			/// An empty address, which has family AF_UNSPEC.
+			CompactAddress() {}
+			
+			/// Throws std::invalid_argument if the address is not IPv4 or IPv6.
+			explicit CompactAddress(const Address & address);
+			
+			/// Whether the address can be represented as a compact address.
+			static bool is_compact(const Address & address) noexcept;
+			
+			Address address() const;
+			operator Address() const {return address();}
+			
+			AddressFamily family() const noexcept {return _family;}
+			Port port() const noexcept {return _port;}
+			
+			bool empty() const noexcept {return _family == 0;}
+			
+			bool operator==(const CompactAddress & other) const noexcept {return std::memcmp(this, &other, sizeof(*this)) == 0;}
+			bool operator!=(const CompactAddress & other) const noexcept {return !(*this == other);}
+			
+			/// A hash of the whole address, mixed so that the low bits can be used directly as an index into a power of two sized table.
+			std::size_t hash() const noexcept
+			{
+				std::uint64_t words[3];
+				std::memcpy(words, this, sizeof(words));
+				
+				auto value = words[0] * 0x9E3779B97F4A7C15ull ^ words[1] * 0xC2B2AE3D27D4EB4Full ^ words[2] * 0x165667B19E3779F9ull;
+				
+				value ^= value >> 32;
+				value *= 0xD6E8FEB86659FD93ull;
+				value ^= value >> 32;
+				
+				return static_cast<std::size_t>(value);
+			}
+			
+		private:
+			std::uint8_t _bytes[16] = {0};
+			std::uint32_t _scope = 0;
+			
+			std::uint16_t _port = 0;
+			std::uint8_t _family = 0;
+			std::uint8_t _reserved = 0;
+		};
+		
+		static_assert(sizeof(CompactAddress) == 24, "CompactAddress should be 24 bytes!");
+		
+		std::ostream & operator<<(std::ostream & output, const CompactAddress & address);
+	}
+}
+
+namespace std
+{
+	template <>
+	struct hash<Async::Network::CompactAddress>
+	{
+		std::size_t operator()(const Async::Network::CompactAddress & address) const noexcept
+		{
+			return address.hash();
+		}
+	};
+}
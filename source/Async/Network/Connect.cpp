@@ -0,0 +1,238 @@
+//
+//  Connect.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Connect.hpp"
+
+#include <Async/Readable.hpp>
+#include <Time/Timer.hpp>
+
+#include <system_error>
+#include <stdexcept>
+#include <cmath>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+		Endpoints interleave_families(const Endpoints & endpoints)
+		{
+			if (endpoints.empty()) return endpoints;
+			
+			auto first_family = endpoints.front().address().family();
+			
+			Endpoints first, second, result;
+			
+			for (auto & endpoint : endpoints) {
+				if (endpoint.address().family() == first_family)
+					first.push_back(endpoint);
+				else
+					second.push_back(endpoint);
+			}
+			
+			result.reserve(endpoints.size());
+			
+			for (std::size_t i = 0; i < first.size() || i < second.size(); i += 1) {
+				if (i < first.size()) result.push_back(first[i]);
+				if (i < second.size()) result.push_back(second[i]);
+			}
+			
+			return result;
+		}
+
+#ifdef __linux__
+		namespace
+		{
+			const std::uint64_t TIMER = ~std::uint64_t(0);
+			
+			void arm(Descriptor timer, Time::Interval interval)
+			{
+				itimerspec value = {};
+				
+				double seconds = interval;
+				value.it_value.tv_sec = static_cast<time_t>(seconds);
+				value.it_value.tv_nsec = static_cast<long>((seconds - std::floor(seconds)) * 1e9);
+				
+				// A zero value would disarm the timer:
+				if (value.it_value.tv_sec == 0 && value.it_value.tv_nsec == 0)
+					value.it_value.tv_nsec = 1;
+				
+				if (::timerfd_settime(timer, 0, &value, nullptr) == -1)
+					throw std::system_error(errno, std::generic_category(), "timerfd_settime");
+			}
+			
+			void control(Descriptor selector, int operation, Descriptor descriptor, std::uint32_t events, std::uint64_t data)
+			{
+				epoll_event event = {};
+				event.events = events;
+				event.data.u64 = data;
+				
+				if (::epoll_ctl(selector, operation, descriptor, &event) == -1)
+					throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+			}
+		}
+		
+		// Outstanding attempts and the stagger timer are multiplexed through a private epoll instance, which is itself waited on through the reactor. This keeps everything in the calling fiber, and closing the losing sockets cancels them.
+		Connection connect_any(const Endpoints & endpoints, Reactor & reactor, Time::Interval attempt_delay)
+		{
+			if (endpoints.empty())
+				throw std::invalid_argument("No endpoints to connect to!");
+			
+			auto ordered = interleave_families(endpoints);
+			
+			Handle selector(::epoll_create1(EPOLL_CLOEXEC));
+			if (selector.descriptor() == -1)
+				throw std::system_error(errno, std::generic_category(), "epoll_create1");
+			
+			Handle timer(::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC));
+			if (timer.descriptor() == -1)
+				throw std::system_error(errno, std::generic_category(), "timerfd_create");
+			
+			control(selector, EPOLL_CTL_ADD, timer, EPOLLIN, TIMER);
+			
+			std::vector<Socket> attempts(ordered.size());
+			std::size_t next = 0, pending = 0, failures = 0;
+			std::exception_ptr error;
+			
+			Time::Timer duration;
+			
+			auto result = [&](std::size_t index) {
+				return Connection{std::move(attempts[index]), ordered[index], duration.time(), next, failures};
+			};
+			
+			// Start the next attempt, returning the index of the attempt if it connected immediately:
+			auto start_next = [&]() -> std::size_t {
+				while (next < ordered.size()) {
+					auto index = next++;
+					auto & endpoint = ordered[index];
+					
+					try {
+						Socket socket(endpoint.socket_domain(), endpoint.socket_type(), endpoint.socket_protocol());
+						
+						// As Endpoint::connect, so options such as TCP_NODELAY apply to whichever attempt wins:
+						endpoint.options().apply(socket, endpoint.socket_domain(), endpoint.socket_type());
+						
+						auto status = ::connect(socket, endpoint.address().data(), endpoint.address().size());
+						
+						if (status == 0) {
+							attempts[index] = std::move(socket);
+							return index;
+						} else if (errno != EINPROGRESS) {
+							throw std::system_error(errno, std::generic_category(), "connect");
+						}
+						
+						control(selector, EPOLL_CTL_ADD, socket, EPOLLOUT, index);
+						attempts[index] = std::move(socket);
+						pending += 1;
+						
+						if (next < ordered.size())
+							arm(timer, attempt_delay);
+						
+						break;
+					} catch (...) {
+						error = std::current_exception();
+						failures += 1;
+					}
+				}
+				
+				return ordered.size();
+			};
+			
+			auto index = start_next();
+			if (index < ordered.size()) return result(index);
+			
+			Readable event(selector, reactor);
+			epoll_event events[16];
+			
+			while (pending > 0 || next < ordered.size()) {
+				auto count = ::epoll_wait(selector, events, 16, 0);
+				
+				if (count == -1) {
+					if (errno == EINTR) continue;
+					
+					throw std::system_error(errno, std::generic_category(), "epoll_wait");
+				} else if (count == 0) {
+					event.wait();
+					continue;
+				}
+				
+				for (int i = 0; i < count; i += 1) {
+					if (events[i].data.u64 == TIMER) {
+						std::uint64_t expirations;
+						while (::read(timer, &expirations, sizeof(expirations)) > 0);
+						
+						index = start_next();
+						if (index < ordered.size()) return result(index);
+						
+						continue;
+					}
+					
+					index = events[i].data.u64;
+					auto & socket = attempts[index];
+					
+					int status = 0;
+					socklen_t size = sizeof(status);
+					
+					if (::getsockopt(socket, SOL_SOCKET, SO_ERROR, &status, &size) == -1)
+						status = errno;
+					
+					if (status == 0) {
+						control(selector, EPOLL_CTL_DEL, socket, 0, 0);
+						
+						return result(index);
+					}
+					
+					// This attempt failed, so start the next one without waiting for the timer:
+					error = std::make_exception_ptr(std::system_error(status, std::generic_category(), "connect"));
+					failures += 1;
+					pending -= 1;
+					
+					control(selector, EPOLL_CTL_DEL, socket, 0, 0);
+					socket = Socket();
+					
+					index = start_next();
+					if (index < ordered.size()) return result(index);
+				}
+			}
+			
+			std::rethrow_exception(error);
+		}
+#else
+		Connection connect_any(const Endpoints & endpoints, Reactor & reactor, Time::Interval attempt_delay)
+		{
+			if (endpoints.empty())
+				throw std::invalid_argument("No endpoints to connect to!");
+			
+			// Without a way to multiplex attempts, fall back to connecting to each endpoint in turn.
+			auto ordered = interleave_families(endpoints);
+			std::exception_ptr error;
+			std::size_t failures = 0;
+			
+			Time::Timer duration;
+			
+			for (auto & endpoint : ordered) {
+				try {
+					auto socket = endpoint.connect(reactor);
+					
+					return Connection{std::move(socket), endpoint, duration.time(), failures + 1, failures};
+				} catch (...) {
+					error = std::current_exception();
+					failures += 1;
+				}
+			}
+			
+			std::rethrow_exception(error);
+		}
+#endif
+	}
+}
@@ -0,0 +1,43 @@
+//
+//  Connect.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Endpoint.hpp"
+
+#include <Time/Interval.hpp>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// The result of connecting to one of several endpoints.
+		struct Connection
+		{
+			Socket socket;
+			
+			/// The endpoint which connected first.
+			Endpoint endpoint;
+			
+			/// The time taken from the first attempt until the connection was established.
+			Time::Interval duration;
+			
+			/// The number of connection attempts which were started, including the successful one.
+			std::size_t attempts;
+			
+			/// The number of attempts which failed before a connection was established.
+			std::size_t failures;
+		};
+		
+		/// Order endpoints so that address families alternate, starting with the family of the first endpoint (RFC 8305, section 4).
+		Endpoints interleave_families(const Endpoints & endpoints);
+		
+		/// Connect to whichever endpoint responds first, using the "Happy Eyeballs" algorithm (RFC 8305). Attempts are started in interleaved address family order, each one attempt_delay after the previous, or immediately if the previous attempt fails. The first attempt to connect wins and all others are closed. If every attempt fails, the last error is thrown.
+		Connection connect_any(const Endpoints & endpoints, Reactor & reactor, Time::Interval attempt_delay = 0.25);
+	}
+}
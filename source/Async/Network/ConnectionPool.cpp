@@ -0,0 +1,177 @@
+//
+//  ConnectionPool.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ConnectionPool.hpp"
+
+#include <system_error>
+
+#include <sys/socket.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		ConnectionPool::Lease::Lease(ConnectionPool & pool, Bucket & bucket, Socket && socket, bool reused) : _pool(pool._self), _bucket(&bucket), _socket(std::move(socket)), _reused(reused)
+		{
+		}
+		
+		ConnectionPool::Lease::Lease(Lease && other) : _pool(std::move(other._pool)), _bucket(other._bucket), _socket(std::move(other._socket)), _reused(other._reused)
+		{
+			other._pool.reset();
+		}
+		
+		ConnectionPool::Lease::~Lease()
+		{
+			discard();
+		}
+		
+		void ConnectionPool::Lease::release()
+		{
+			if (auto pool = _pool.lock()) {
+				(*pool)->release(*_bucket, std::move(_socket));
+			} else {
+				_socket = Socket();
+			}
+			
+			_pool.reset();
+		}
+		
+		void ConnectionPool::Lease::discard()
+		{
+			_socket = Socket();
+			
+			if (auto pool = _pool.lock())
+				(*pool)->discard(*_bucket);
+			
+			_pool.reset();
+		}
+		
+		ConnectionPool::ConnectionPool(Reactor & reactor, const Options & options) : _reactor(reactor), _options(options), _self(std::make_shared<ConnectionPool *>(this))
+		{
+		}
+		
+		ConnectionPool::~ConnectionPool()
+		{
+		}
+		
+		bool ConnectionPool::is_alive(const Socket & socket)
+		{
+			char byte;
+			
+			auto result = ::recv(socket, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+			
+			// Nothing to read is the expected state of an idle connection. Zero means the peer closed it, and data means the connection is out of step with the protocol.
+			return result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK);
+		}
+		
+		ConnectionPool::Lease ConnectionPool::acquire(const Endpoint & endpoint)
+		{
+			auto & bucket = _buckets[endpoint.address()];
+			
+			while (true) {
+				evict(bucket, Clock::now());
+				
+				// The most recently released connection is the least likely to have been closed by the peer:
+				while (!bucket.idle.empty()) {
+					auto socket = std::move(bucket.idle.back().socket);
+					bucket.idle.pop_back();
+					
+					if (is_alive(socket)) {
+						bucket.active += 1;
+						_statistics.reused += 1;
+						
+						return Lease(*this, bucket, std::move(socket), true);
+					}
+					
+					_statistics.discarded += 1;
+				}
+				
+				if (bucket.active < _options.maximum_active) {
+					bucket.active += 1;
+					
+					try {
+						auto socket = endpoint.connect(_reactor);
+						_statistics.connected += 1;
+						
+						return Lease(*this, bucket, std::move(socket), false);
+					} catch (...) {
+						bucket.active -= 1;
+						_statistics.failed += 1;
+						
+						bucket.available.signal();
+						
+						throw;
+					}
+				}
+				
+				_statistics.waits += 1;
+				bucket.available.wait();
+			}
+		}
+		
+		void ConnectionPool::release(Bucket & bucket, Socket && socket)
+		{
+			bucket.active -= 1;
+			
+			if (bucket.idle.size() < _options.maximum_idle) {
+				bucket.idle.push_back(Idle{std::move(socket), Clock::now()});
+			} else {
+				_statistics.discarded += 1;
+			}
+			
+			bucket.available.signal();
+		}
+		
+		void ConnectionPool::discard(Bucket & bucket)
+		{
+			bucket.active -= 1;
+			_statistics.discarded += 1;
+			
+			bucket.available.signal();
+		}
+		
+		std::size_t ConnectionPool::evict(Bucket & bucket, Clock::time_point now)
+		{
+			auto timeout = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(_options.idle_timeout));
+			std::size_t count = 0;
+			
+			// Idle connections are kept in release order, so the oldest are at the front:
+			while (!bucket.idle.empty() && bucket.idle.front().released + timeout <= now) {
+				bucket.idle.pop_front();
+				count += 1;
+			}
+			
+			_statistics.evicted += count;
+			
+			return count;
+		}
+		
+		std::size_t ConnectionPool::evict()
+		{
+			auto now = Clock::now();
+			std::size_t count = 0;
+			
+			for (auto & pair : _buckets) {
+				count += evict(pair.second, now);
+			}
+			
+			return count;
+		}
+		
+		std::size_t ConnectionPool::idle() const
+		{
+			std::size_t count = 0;
+			
+			for (auto & pair : _buckets) {
+				count += pair.second.idle.size();
+			}
+			
+			return count;
+		}
+	}
+}
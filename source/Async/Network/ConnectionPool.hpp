@@ -0,0 +1,142 @@
+//
+//  ConnectionPool.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Endpoint.hpp"
+
+#include <Concurrent/Condition.hpp>
+#include <Time/Interval.hpp>
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Reuses connected sockets, keyed by the address of the endpoint they are connected to. A pool belongs to a single reactor and is not thread-safe; fibers which need a connection when the limit is reached wait until one is released.
+		class ConnectionPool
+		{
+		public:
+			struct Options
+			{
+				Options() {}
+				
+				/// The maximum number of idle connections kept for each address.
+				std::size_t maximum_idle = 8;
+				
+				/// The maximum number of connections in use for each address. Further requests wait for a connection to be released.
+				std::size_t maximum_active = 64;
+				
+				/// Idle connections older than this are closed rather than reused.
+				Time::Interval idle_timeout = 60;
+			};
+			
+			struct Statistics
+			{
+				std::size_t connected = 0;
+				std::size_t reused = 0;
+				std::size_t discarded = 0;
+				std::size_t evicted = 0;
+				
+				/// Connection attempts which failed. These are not counted as discarded, since no connection was made.
+				std::size_t failed = 0;
+				std::size_t waits = 0;
+			};
+			
+		private:
+			typedef std::chrono::steady_clock Clock;
+			
+			struct Idle
+			{
+				Socket socket;
+				Clock::time_point released;
+			};
+			
+			struct Bucket
+			{
+				std::deque<Idle> idle;
+				std::size_t active = 0;
+				
+				Concurrent::Condition available;
+			};
+			
+		public:
+			/// A connection checked out of the pool. Call release() once the connection is in a clean state for the next user; otherwise it is closed when the lease is destroyed. A lease may outlive its pool, in which case the connection is simply closed.
+			class Lease
+			{
+			public:
+				Lease(ConnectionPool & pool, Bucket & bucket, Socket && socket, bool reused);
+				~Lease();
+				
+				Lease(Lease && other);
+				
+				Lease(const Lease &) = delete;
+				Lease & operator=(const Lease &) = delete;
+				
+				Socket & socket() {return _socket;}
+				operator Socket & () {return _socket;}
+				
+				/// Whether the connection was taken from the idle list, rather than newly connected.
+				bool reused() const noexcept {return _reused;}
+				
+				/// Return the connection to the pool for reuse.
+				void release();
+				
+				/// Close the connection and free its slot in the pool.
+				void discard();
+				
+			private:
+				/// Expires when the pool is destroyed, after which the bucket must not be used.
+				std::weak_ptr<ConnectionPool *> _pool;
+				Bucket * _bucket;
+				
+				Socket _socket;
+				bool _reused;
+			};
+			
+			ConnectionPool(Reactor & reactor, const Options & options = Options());
+			~ConnectionPool();
+			
+			ConnectionPool(const ConnectionPool &) = delete;
+			ConnectionPool & operator=(const ConnectionPool &) = delete;
+			
+			/// Check out a live idle connection to the endpoint's address if there is one, otherwise connect a new one. Waits if the maximum number of active connections has been reached.
+			Lease acquire(const Endpoint & endpoint);
+			
+			/// Close idle connections which have exceeded the idle timeout. Returns the number closed.
+			std::size_t evict();
+			
+			/// The number of idle connections for all addresses.
+			std::size_t idle() const;
+			
+			const Statistics & statistics() const noexcept {return _statistics;}
+			
+			/// Whether an idle connection is still usable: the peer has not closed it, and there is no unread data which would be mistaken for a response.
+			static bool is_alive(const Socket & socket);
+			
+		private:
+			void release(Bucket & bucket, Socket && socket);
+			void discard(Bucket & bucket);
+			
+			std::size_t evict(Bucket & bucket, Clock::time_point now);
+			
+			Reactor & _reactor;
+			Options _options;
+			
+			/// Shared with every lease, so that leases can tell whether the pool still exists.
+			std::shared_ptr<ConnectionPool *> _self;
+			
+			std::map<Address, Bucket> _buckets;
+			Statistics _statistics;
+		};
+	}
+}
@@ -0,0 +1,146 @@
+//
+//  Datagrams.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Datagrams.hpp"
+
+#include <Async/Readable.hpp>
+#include <Async/Writable.hpp>
+
+#include <system_error>
+#include <stdexcept>
+#include <cstring>
+#include <memory>
+
+#ifdef __linux__
+#define HAVE_MMSG
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+		Datagrams::Datagrams(std::size_t capacity, std::size_t message_size) : _message_size(message_size), _storage(capacity * message_size), _lengths(capacity), _addresses(capacity), _truncated(capacity), _vectors(capacity), _messages(capacity)
+		{
+			if (capacity == 0)
+				throw std::invalid_argument("Datagrams require a capacity of at least 1!");
+		}
+		
+		Datagrams::~Datagrams()
+		{
+		}
+		
+		void Datagrams::push_back(const void * data, std::size_t size, const Address & address)
+		{
+			if (full())
+				throw std::length_error("Datagrams are full!");
+			
+			if (size > _message_size)
+				throw std::length_error("Datagram is larger than the message size!");
+			
+			std::memcpy(&_storage[_size * _message_size], data, size);
+			_lengths[_size] = size;
+			_addresses[_size] = address;
+			_truncated[_size] = false;
+			
+			_size += 1;
+		}
+		
+		void Datagrams::send(Socket & socket, Reactor & reactor)
+		{
+			for (std::size_t i = 0; i < _size; i += 1) {
+				auto & header = Datagrams::header(_messages[i]);
+				auto & address = _addresses[i];
+				
+				_vectors[i].iov_base = &_storage[i * _message_size];
+				_vectors[i].iov_len = _lengths[i];
+				
+				header = msghdr();
+				header.msg_name = address.size() ? address.data() : nullptr;
+				header.msg_namelen = address.size();
+				header.msg_iov = &_vectors[i];
+				header.msg_iovlen = 1;
+			}
+			
+			std::unique_ptr<Writable> event;
+			std::size_t sent = 0;
+			
+			while (sent < _size) {
+#ifdef HAVE_MMSG
+				auto result = ::sendmmsg(socket, &_messages[sent], _size - sent, 0);
+#else
+				auto result = ::sendmsg(socket, &_messages[sent], 0);
+				if (result >= 0) result = 1;
+#endif
+				
+				if (result >= 0) {
+					sent += result;
+				} else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					if (!event) event.reset(new Writable(socket, reactor));
+					
+					event->wait();
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "sendmmsg");
+				}
+			}
+			
+			clear();
+		}
+		
+		std::size_t Datagrams::receive(Socket & socket, Reactor & reactor)
+		{
+			for (std::size_t i = 0; i < capacity(); i += 1) {
+				auto & header = Datagrams::header(_messages[i]);
+				
+				_vectors[i].iov_base = &_storage[i * _message_size];
+				_vectors[i].iov_len = _message_size;
+				
+				header = msghdr();
+				header.msg_name = _addresses[i].data();
+				header.msg_namelen = Address::capacity();
+				header.msg_iov = &_vectors[i];
+				header.msg_iovlen = 1;
+			}
+			
+			std::unique_ptr<Readable> event;
+			
+			while (true) {
+#ifdef HAVE_MMSG
+				auto result = ::recvmmsg(socket, _messages.data(), _messages.size(), 0, nullptr);
+				
+				if (result > 0) {
+					for (int i = 0; i < result; i += 1) {
+						_lengths[i] = _messages[i].msg_len;
+						_addresses[i].resize(_messages[i].msg_hdr.msg_namelen);
+						_truncated[i] = _messages[i].msg_hdr.msg_flags & MSG_TRUNC;
+					}
+					
+					return _size = result;
+				}
+#else
+				auto result = ::recvmsg(socket, &_messages[0], 0);
+				
+				if (result >= 0) {
+					_lengths[0] = result;
+					_addresses[0].resize(_messages[0].msg_namelen);
+					_truncated[0] = _messages[0].msg_flags & MSG_TRUNC;
+					
+					return _size = 1;
+				}
+#endif
+				
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					if (!event) event.reset(new Readable(socket, reactor));
+					
+					event->wait();
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "recvmmsg");
+				}
+			}
+		}
+	}
+}
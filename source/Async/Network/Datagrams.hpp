@@ -0,0 +1,79 @@
+//
+//  Datagrams.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Socket.hpp"
+
+#include <vector>
+
+#include <sys/socket.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A preallocated batch of datagrams, sent and received with one system call per batch (sendmmsg/recvmmsg) where supported. Message buffers and peer addresses are allocated once, and are filled in place on every receive.
+		class Datagrams
+		{
+		public:
+			Datagrams(std::size_t capacity, std::size_t message_size = 2048);
+			~Datagrams();
+			
+			Datagrams(const Datagrams &) = delete;
+			Datagrams & operator=(const Datagrams &) = delete;
+			
+			std::size_t capacity() const noexcept {return _addresses.size();}
+			std::size_t message_size() const noexcept {return _message_size;}
+			
+			/// The number of messages currently in the batch.
+			std::size_t size() const noexcept {return _size;}
+			bool empty() const noexcept {return _size == 0;}
+			bool full() const noexcept {return _size == capacity();}
+			
+			void clear() noexcept {_size = 0;}
+			
+			/// Copy a message into the next free slot, to be sent to the given address. An empty address can be used with a connected socket.
+			void push_back(const void * data, std::size_t size, const Address & address = Address());
+			
+			const char * data(std::size_t index) const {return _storage.data() + index * _message_size;}
+			std::size_t length(std::size_t index) const {return _lengths[index];}
+			const Address & address(std::size_t index) const {return _addresses[index];}
+			
+			/// Whether a received message was larger than message_size, in which case only the first message_size bytes were kept and the rest was discarded.
+			bool truncated(std::size_t index) const {return _truncated[index];}
+			
+			/// Send every message in the batch, waiting on the reactor as required, then clear it.
+			void send(Socket & socket, Reactor & reactor);
+			
+			/// Replace the contents of the batch with as many messages as are available, up to capacity, waiting for at least one. Returns the number of messages received.
+			std::size_t receive(Socket & socket, Reactor & reactor);
+			
+		private:
+#ifdef __linux__
+			// Used with sendmmsg/recvmmsg.
+			typedef mmsghdr Message;
+			static msghdr & header(Message & message) {return message.msg_hdr;}
+#else
+			typedef msghdr Message;
+			static msghdr & header(Message & message) {return message;}
+#endif
+			
+			std::size_t _message_size;
+			std::size_t _size = 0;
+			
+			std::vector<char> _storage;
+			std::vector<std::size_t> _lengths;
+			std::vector<Address> _addresses;
+			std::vector<bool> _truncated;
+			
+			std::vector<iovec> _vectors;
+			std::vector<Message> _messages;
+		};
+	}
+}
@@ -0,0 +1,206 @@
+//
+//  Deadline.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Deadline.hpp"
+
+#include <system_error>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#else
+#include <Async/After.hpp>
+#include <Async/Writable.hpp>
+#include <Concurrent/Condition.hpp>
+#include <Concurrent/Fiber.hpp>
+#include <poll.h>
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+		Deadline::Deadline(Time::Interval timeout) : _expires(Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(timeout)))
+		{
+		}
+		
+		Deadline::~Deadline()
+		{
+		}
+		
+		Time::Interval Deadline::remaining() const
+		{
+			auto now = Clock::now();
+			
+			if (now >= _expires) return 0;
+			
+			return std::chrono::duration<double>(_expires - now).count();
+		}
+		
+		bool Deadline::expired() const
+		{
+			return Clock::now() >= _expires;
+		}
+		
+		void Deadline::timed_out() const
+		{
+			throw std::system_error(ETIMEDOUT, std::generic_category(), "deadline");
+		}
+		
+		void Deadline::wait_readable(Descriptor descriptor, Reactor & reactor) const
+		{
+			wait(descriptor, false, reactor);
+		}
+		
+		void Deadline::wait_writable(Descriptor descriptor, Reactor & reactor) const
+		{
+			wait(descriptor, true, reactor);
+		}
+
+#ifdef __linux__
+		namespace
+		{
+			const std::uint64_t TIMER = 0, DESCRIPTOR = 1;
+			
+			void control(Descriptor selector, int operation, Descriptor descriptor, std::uint32_t events, std::uint64_t data)
+			{
+				epoll_event event = {};
+				event.events = events;
+				event.data.u64 = data;
+				
+				if (::epoll_ctl(selector, operation, descriptor, &event) == -1)
+					throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+			}
+			
+			// Removes the descriptor from the selector however the wait finishes, including when the fiber is stopped.
+			struct Registration
+			{
+				Registration(Descriptor selector, Descriptor descriptor, std::uint32_t events) : selector(selector), descriptor(descriptor)
+				{
+					control(selector, EPOLL_CTL_ADD, descriptor, events, DESCRIPTOR);
+				}
+				
+				~Registration()
+				{
+					epoll_event event = {};
+					::epoll_ctl(selector, EPOLL_CTL_DEL, descriptor, &event);
+				}
+				
+				Descriptor selector, descriptor;
+			};
+		}
+		
+		void Deadline::wait(Descriptor descriptor, bool writable, Reactor & reactor) const
+		{
+			auto seconds = static_cast<double>(remaining());
+			
+			if (seconds <= 0) timed_out();
+			
+			if (_selector.descriptor() == -1) {
+				_selector = Handle(::epoll_create1(EPOLL_CLOEXEC));
+				if (_selector.descriptor() == -1)
+					throw std::system_error(errno, std::generic_category(), "epoll_create1");
+				
+				_timer = Handle(::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC));
+				if (_timer.descriptor() == -1)
+					throw std::system_error(errno, std::generic_category(), "timerfd_create");
+				
+				itimerspec value = {};
+				value.it_value.tv_sec = static_cast<time_t>(seconds);
+				value.it_value.tv_nsec = static_cast<long>((seconds - std::floor(seconds)) * 1e9);
+				
+				// A zero value would disarm the timer:
+				if (value.it_value.tv_sec == 0 && value.it_value.tv_nsec == 0)
+					value.it_value.tv_nsec = 1;
+				
+				if (::timerfd_settime(_timer, 0, &value, nullptr) == -1)
+					throw std::system_error(errno, std::generic_category(), "timerfd_settime");
+				
+				control(_selector, EPOLL_CTL_ADD, _timer, EPOLLIN, TIMER);
+			}
+			
+			if (_reactor != &reactor) {
+				_event.reset(new Readable(_selector, reactor));
+				_reactor = &reactor;
+			}
+			
+			Registration registration(_selector, descriptor, writable ? EPOLLOUT : EPOLLIN);
+			
+			epoll_event events[2];
+			
+			while (true) {
+				auto count = ::epoll_wait(_selector, events, 2, 0);
+				
+				if (count == -1) {
+					if (errno == EINTR) continue;
+					
+					throw std::system_error(errno, std::generic_category(), "epoll_wait");
+				}
+				
+				bool expired = false;
+				
+				// If the descriptor became ready at the same time as the timer expired, the operation can still complete:
+				for (int i = 0; i < count; i += 1) {
+					if (events[i].data.u64 == DESCRIPTOR) return;
+					
+					expired = true;
+				}
+				
+				if (expired) timed_out();
+				
+				_event->wait();
+			}
+		}
+#else
+		// Without a selector which can also wait on a timer, race a readiness wait against a single timer for the remaining time, each in its own fiber. Whichever loses is stopped when the pool is destroyed.
+		void Deadline::wait(Descriptor descriptor, bool writable, Reactor & reactor) const
+		{
+			pollfd request = {descriptor, static_cast<short>(writable ? POLLOUT : POLLIN), 0};
+			
+			if (::poll(&request, 1, 0) > 0) return;
+			
+			auto seconds = static_cast<double>(remaining());
+			
+			if (seconds <= 0) timed_out();
+			
+			Concurrent::Condition finished;
+			bool ready = false, expired = false;
+			
+			{
+				Concurrent::Fiber::Pool fibers;
+				
+				fibers.resume([&]{
+					if (writable)
+						Writable(descriptor, reactor).wait();
+					else
+						Readable(descriptor, reactor).wait();
+					
+					ready = true;
+					finished.signal();
+				});
+				
+				fibers.resume([&]{
+					After(seconds, reactor).wait();
+					
+					expired = true;
+					finished.signal();
+				});
+				
+				while (!ready && !expired) finished.wait();
+			}
+			
+			// If the descriptor became ready first, the operation can still complete:
+			if (!ready) timed_out();
+		}
+#endif
+	}
+}
@@ -0,0 +1,60 @@
+//
+//  Deadline.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Async/Handle.hpp>
+#include <Async/Readable.hpp>
+#include <Time/Interval.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace Async
+{
+	class Reactor;
+	
+	namespace Network
+	{
+		/// A point in time by which one or more operations must complete. Operations given a deadline wait until the socket is ready or the deadline expires, whichever is first, and throw std::system_error(ETIMEDOUT) on expiry. A single deadline can bound a whole request, e.g. connect, send and receive.
+		///
+		/// A deadline is not free: on Linux, the first wait creates an epoll instance and a timerfd, and every wait adds and removes the descriptor with epoll_ctl. Create one deadline per request rather than one per call, and prefer plain waits where no timeout is needed.
+		class Deadline
+		{
+		public:
+			typedef std::chrono::steady_clock Clock;
+			
+			Deadline(Time::Interval timeout);
+			~Deadline();
+			
+			Deadline(const Deadline &) = delete;
+			Deadline & operator=(const Deadline &) = delete;
+			
+			/// The time remaining, which is zero once expired.
+			Time::Interval remaining() const;
+			bool expired() const;
+			
+			/// Wait until the descriptor is readable, or throw if the deadline expires first.
+			void wait_readable(Descriptor descriptor, Reactor & reactor) const;
+			
+			/// Wait until the descriptor is writable, or throw if the deadline expires first.
+			void wait_writable(Descriptor descriptor, Reactor & reactor) const;
+			
+		private:
+			void wait(Descriptor descriptor, bool writable, Reactor & reactor) const;
+			[[noreturn]] void timed_out() const;
+			
+			Clock::time_point _expires;
+			
+			// The timer and the descriptor being waited on are multiplexed through a private selector, which is waited on through the reactor. These are created by the first wait, and reused by later ones.
+			mutable Handle _selector, _timer;
+			mutable std::unique_ptr<Readable> _event;
+			mutable Reactor * _reactor = nullptr;
+		};
+	}
+}
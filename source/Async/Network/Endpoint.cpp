@@ -10,6 +10,8 @@
 
 #include <system_error>
 #include <stdexcept>
+#include <cstdlib>
+#include <algorithm>
 
 namespace Async
 {
@@ -35,8 +37,36 @@ namespace Async
 			return for_name(nullptr, service.name().c_str(), &hints);
 		}
 		
+		namespace
+		{
+			bool numeric_port(const std::string & name, Port & port)
+			{
+				if (name.empty() || name.size() > 5) return false;
+				
+				for (auto character : name) {
+					if (character < '0' || character > '9') return false;
+				}
+				
+				port = std::atoi(name.c_str());
+				
+				return port <= 65535;
+			}
+		}
+		
 		Endpoints Endpoint::named_endpoints(const std::string & host, const Service & service, Socket::Type socket_type)
 		{
+			// A numeric host and port can be used directly, without the cost of getaddrinfo. Bracketed hosts and hosts with a port are left to getaddrinfo to reject as before:
+			if ((socket_type == SOCK_STREAM || socket_type == SOCK_DGRAM) && !host.empty() && host.front() != '[' && std::count(host.begin(), host.end(), ':') != 1) {
+				Address address;
+				Port port;
+				
+				if (numeric_port(service.name(), port) && Address::parse_numeric(host.data(), host.size(), address)) {
+					address.set_port(port);
+					
+					return {Endpoint(address, address.family(), socket_type, socket_type == SOCK_STREAM ? IPPROTO_TCP : IPPROTO_UDP)};
+				}
+			}
+			
 			struct addrinfo hints = {0};
 
 			hints.ai_family = AF_UNSPEC;
@@ -45,6 +75,11 @@ namespace Async
 			return for_name(host.c_str(), service.name().c_str(), &hints);
 		}
 		
+		Endpoint Endpoint::unix_domain(const std::string & path, Socket::Type socket_type)
+		{
+			return Endpoint(Address::unix_domain(path), AF_UNIX, socket_type, 0);
+		}
+		
 		Endpoints Endpoint::named_endpoints(const URI::Generic & uri)
 		{
 			// Figure out the service using the scheme, or override with port if specified:
@@ -57,6 +92,11 @@ namespace Async
 			if (!uri.fragment.empty())
 				socket_type = socket_type_for_name(uri.fragment);
 			
+			// The path of a UNIX domain socket is the path of the URI, e.g. "unix:/run/app.sock", or the host if written as "unix://@name":
+			if (uri.scheme == "unix") {
+				return {unix_domain(uri.path.empty() ? uri.host : uri.path, socket_type)};
+			}
+			
 			return named_endpoints(uri.hostname(), service, socket_type);
 		}
 		
@@ -93,7 +133,7 @@ namespace Async
 		{
 			if (name == "tcp" || name == "stream") {
 				return SOCK_STREAM;
-			} else if (name == "udp" || name == "udp") {
+			} else if (name == "udp" || name == "datagram" || name == "dgram") {
 				return SOCK_DGRAM;
 			} else if (name == "raw") {
 				return SOCK_RAW;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Socket.hpp"
+#include "SocketOptions.hpp"
 #include "Service.hpp"
 
 #include <URI/Generic.hpp>
@@ -41,40 +42,91 @@ namespace Async
 			const Socket::Type & socket_type() const {return _socket_type;}
 			const Socket::Protocol & socket_protocol() const {return _socket_protocol;}
 			
+			/// Options applied to every socket bound or connected using this endpoint.
+			const SocketOptions & options() const {return _options;}
+			void set_options(const SocketOptions & options) {_options = options;}
+			
 			static Endpoints service_endpoints(const Service & service, Socket::Type socket_type = SOCK_STREAM);
 			static Endpoints named_endpoints(const std::string & host, const Service & service, Socket::Type socket_type = SOCK_STREAM);
 			
+			/// Endpoints for a URI such as "tcp://localhost:80". A "unix:" URI, e.g. "unix:/run/app.sock" or "unix:@name#datagram", gives a single UNIX domain endpoint.
 			static Endpoints named_endpoints(const URI::Generic & uri);
 			
+			/// A UNIX domain endpoint for the given path, or abstract name if the path starts with "@". See Address::unix_domain. Binding to a path fails with EADDRINUSE if the file already exists, even if nothing is listening, so stale sockets must be removed first.
+			static Endpoint unix_domain(const std::string & path, Socket::Type socket_type = SOCK_STREAM);
+			
+			/// Map a name such as "tcp" or "udp" (typically the fragment of a URI) to a socket type.
+			static Socket::Type socket_type_for_name(const std::string & name);
+			
+			/// Bind a socket using the endpoint's options. The address is reused unless reuse_address is false or the options say otherwise. UNIX domain addresses are never reused.
 			Socket bind(bool reuse_address = true) const
+			{
+				return bind(_options, reuse_address);
+			}
+			
+			/// Bind a socket using the given options instead of the endpoint's. The address is reused in the same way.
+			Socket bind(const SocketOptions & options, bool reuse_address = true) const
 			{
 				Socket socket(_socket_domain, _socket_type, _socket_protocol);
 				
-				socket.set_reuse_address();
+				if (reuse_address && _socket_domain != AF_UNIX && !options.has_reuse_address())
+					socket.set_reuse_address();
+				
+				options.apply(socket, _socket_domain, _socket_type);
 				socket.bind(_address);
 				
 				return socket;
 			}
 			
 			Socket connect(Reactor & reactor) const
+			{
+				return connect(reactor, _options);
+			}
+			
+			/// Connect a socket using the given options instead of the endpoint's.
+			Socket connect(Reactor & reactor, const SocketOptions & options) const
 			{
 				Socket socket(_socket_domain, _socket_type, _socket_protocol);
 				
+				options.apply(socket, _socket_domain, _socket_type);
 				socket.connect(_address, reactor);
 				
 				return socket;
 			}
 			
+			/// Connect and send the data, using TCP Fast Open if possible. See Socket::connect.
+			Socket connect(Reactor & reactor, const void * data, std::size_t size) const
+			{
+				Socket socket(_socket_domain, _socket_type, _socket_protocol);
+				
+				_options.apply(socket, _socket_domain, _socket_type);
+				socket.connect(_address, data, size, reactor);
+				
+				return socket;
+			}
+			
+			/// Connect, throwing std::system_error(ETIMEDOUT) if the deadline expires first, in which case the socket is closed.
+			Socket connect(Reactor & reactor, const Deadline & deadline) const
+			{
+				Socket socket(_socket_domain, _socket_type, _socket_protocol);
+				
+				_options.apply(socket, _socket_domain, _socket_type);
+				socket.connect(_address, reactor, deadline);
+				
+				return socket;
+			}
+			
 		private:
 			Endpoint(const addrinfo *);
 			static Endpoints for_name(const char * host, const char * service, addrinfo * hints);
-			static Socket::Type socket_type_for_name(const std::string & name);
 			
 			Address _address;
 			
 			Socket::Domain _socket_domain = 0;
 			Socket::Type _socket_type = 0;
 			Socket::Protocol _socket_protocol = 0;
+			
+			SocketOptions _options;
 		};
 	}
 }
@@ -0,0 +1,312 @@
+//
+//  EndpointCache.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "EndpointCache.hpp"
+
+#include <system_error>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+
+namespace Async
+{
+	namespace Network
+	{
+		namespace
+		{
+			Endpoints system_resolve(const std::string & host, const Service & service, Socket::Type socket_type, Resolver::TTL *)
+			{
+				// getaddrinfo does not report a TTL, so the default is used.
+				return Endpoint::named_endpoints(host, service, socket_type);
+			}
+			
+			bool is_negative(std::exception_ptr error)
+			{
+				try {
+					std::rethrow_exception(error);
+				} catch (std::system_error & exception) {
+					return exception.code().value() == EAI_NONAME;
+				} catch (...) {
+					return false;
+				}
+			}
+		}
+		
+		EndpointCache::EndpointCache(const Options & options) : EndpointCache(system_resolve, options)
+		{
+		}
+		
+		EndpointCache::EndpointCache(Resolve resolve, const Options & options) : _resolve(resolve), _options(options)
+		{
+		}
+		
+		EndpointCache::~EndpointCache()
+		{
+		}
+		
+		Endpoints EndpointCache::named_endpoints(const std::string & host, const Service & service, Socket::Type socket_type, Concurrent::Fiber::Pool * refresh)
+		{
+			Key key{host, service.name(), socket_type};
+			
+			std::unique_lock<std::mutex> lock(_mutex);
+			
+			auto iterator = _entries.find(key);
+			
+			if (iterator != _entries.end()) {
+				auto & entry = iterator->second;
+				auto now = Clock::now();
+				
+				if (now < entry.expires) {
+					if (entry.error) {
+						_negative_hits += 1;
+						std::rethrow_exception(entry.error);
+					}
+					
+					_hits += 1;
+					return entry.endpoints;
+				}
+				
+				if (!entry.error && now < entry.expires + std::chrono::seconds(_options.stale_ttl)) {
+					if (entry.refreshing) {
+						_stale_hits += 1;
+						return entry.endpoints;
+					} else if (refresh) {
+						_stale_hits += 1;
+						entry.refreshing = true;
+						
+						auto endpoints = entry.endpoints;
+						
+						// The refresh fiber runs until it first blocks, so release the lock first:
+						lock.unlock();
+						
+						refresh->resume([this, key]{
+							try {
+								resolve(key);
+							} catch (...) {
+								// The stale entry expires normally, and the next caller will see the failure.
+							}
+						});
+						
+						return endpoints;
+					}
+				}
+			}
+			
+			_misses += 1;
+			lock.unlock();
+			
+			return resolve(key);
+		}
+		
+		Endpoints EndpointCache::named_endpoints(const URI::Generic & uri, Concurrent::Fiber::Pool * refresh)
+		{
+			Service service{uri.scheme};
+			if (!uri.port.empty())
+				service = uri.port;
+			
+			Socket::Type socket_type = SOCK_STREAM;
+			if (!uri.fragment.empty())
+				socket_type = Endpoint::socket_type_for_name(uri.fragment);
+			
+			return named_endpoints(uri.hostname(), service, socket_type, refresh);
+		}
+		
+		Endpoints EndpointCache::resolve(const Key & key)
+		{
+			_refreshes += 1;
+			
+			TTL ttl = _options.default_ttl;
+			Endpoints endpoints;
+			
+			try {
+				endpoints = _resolve(std::get<0>(key), std::get<1>(key), std::get<2>(key), &ttl);
+			} catch (...) {
+				store_error(key, std::current_exception());
+				
+				throw;
+			}
+			
+			store(key, endpoints, ttl);
+			
+			return endpoints;
+		}
+		
+		void EndpointCache::insert(const std::string & host, const Service & service, Socket::Type socket_type, const Endpoints & endpoints, TTL ttl)
+		{
+			store(Key{host, service.name(), socket_type}, endpoints, ttl);
+		}
+		
+		EndpointCache::TTL EndpointCache::clamp(TTL ttl) const
+		{
+			return std::min(std::max(ttl, _options.minimum_ttl), _options.maximum_ttl);
+		}
+		
+		void EndpointCache::store(const Key & key, const Endpoints & endpoints, TTL ttl)
+		{
+			std::lock_guard<std::mutex> guard(_mutex);
+			
+			auto & entry = _entries[key];
+			
+			entry.endpoints = endpoints;
+			entry.error = nullptr;
+			entry.expires = Clock::now() + std::chrono::seconds(clamp(ttl));
+			entry.refreshing = false;
+		}
+		
+		void EndpointCache::store_error(const Key & key, std::exception_ptr error)
+		{
+			std::lock_guard<std::mutex> guard(_mutex);
+			
+			if (is_negative(error)) {
+				auto & entry = _entries[key];
+				
+				entry.endpoints.clear();
+				entry.error = error;
+				entry.expires = Clock::now() + std::chrono::seconds(_options.negative_ttl);
+				entry.refreshing = false;
+			} else {
+				// Transient failures are not cached, but allow another refresh to be attempted:
+				auto iterator = _entries.find(key);
+				
+				if (iterator != _entries.end())
+					iterator->second.refreshing = false;
+			}
+		}
+		
+		void EndpointCache::clear()
+		{
+			std::lock_guard<std::mutex> guard(_mutex);
+			
+			_entries.clear();
+		}
+		
+		std::size_t EndpointCache::size() const
+		{
+			std::lock_guard<std::mutex> guard(_mutex);
+			
+			return _entries.size();
+		}
+		
+		EndpointCache::Statistics EndpointCache::statistics() const
+		{
+			Statistics statistics;
+			
+			statistics.hits = _hits;
+			statistics.stale_hits = _stale_hits;
+			statistics.negative_hits = _negative_hits;
+			statistics.misses = _misses;
+			statistics.refreshes = _refreshes;
+			
+			return statistics;
+		}
+		
+		// Each line is: host service type expiry, followed by domain type protocol address-bytes for each endpoint. The expiry is wall clock time in seconds since the epoch, since the steady clock doesn't survive a restart.
+		void EndpointCache::save(const std::string & path) const
+		{
+			std::ofstream output(path, std::ios::trunc);
+			
+			if (!output)
+				throw std::system_error(errno, std::generic_category(), "open");
+			
+			std::lock_guard<std::mutex> guard(_mutex);
+			auto now = Clock::now();
+			auto wall_clock = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			
+			for (auto & pair : _entries) {
+				auto & entry = pair.second;
+				
+				if (entry.error || entry.expires <= now) continue;
+				
+				auto expires = wall_clock + std::chrono::duration_cast<std::chrono::seconds>(entry.expires - now).count();
+				
+				output << std::get<0>(pair.first) << ' ' << std::get<1>(pair.first) << ' ' << std::get<2>(pair.first) << ' ' << expires;
+				
+				for (auto & endpoint : entry.endpoints) {
+					auto & address = endpoint.address();
+					auto bytes = reinterpret_cast<const unsigned char *>(address.data());
+					
+					output << ' ' << endpoint.socket_domain() << ' ' << endpoint.socket_type() << ' ' << endpoint.socket_protocol() << ' ' << std::hex;
+					
+					for (std::size_t i = 0; i < address.size(); i += 1)
+						output << std::setw(2) << std::setfill('0') << unsigned(bytes[i]);
+					
+					output << std::dec;
+				}
+				
+				output << '\n';
+			}
+		}
+		
+		namespace
+		{
+			// Parse pairs of hex digits, returning false if the text is malformed.
+			bool parse_hex(const std::string & hex, unsigned char * bytes, std::size_t capacity, std::size_t & size)
+			{
+				if (hex.size() % 2 || hex.size() / 2 > capacity)
+					return false;
+				
+				size = hex.size() / 2;
+				
+				for (std::size_t i = 0; i < size; i += 1) {
+					if (!std::isxdigit(static_cast<unsigned char>(hex[i*2])) || !std::isxdigit(static_cast<unsigned char>(hex[i*2+1])))
+						return false;
+					
+					bytes[i] = std::strtoul(hex.substr(i * 2, 2).c_str(), nullptr, 16);
+				}
+				
+				return true;
+			}
+		}
+		
+		std::size_t EndpointCache::load(const std::string & path)
+		{
+			std::ifstream input(path);
+			std::string line;
+			std::size_t count = 0;
+			
+			auto now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			
+			while (std::getline(input, line)) {
+				std::istringstream fields(line);
+				
+				std::string host, service, hex;
+				Socket::Type socket_type;
+				long long expires;
+				
+				if (!(fields >> host >> service >> socket_type >> expires) || expires <= now)
+					continue;
+				
+				Endpoints endpoints;
+				Socket::Domain domain; Socket::Type type; Socket::Protocol protocol;
+				bool valid = true;
+				
+				while (fields >> domain >> type >> protocol >> hex) {
+					sockaddr_storage storage;
+					std::size_t size = 0;
+					
+					if (!parse_hex(hex, reinterpret_cast<unsigned char *>(&storage), sizeof(storage), size)) {
+						valid = false;
+						break;
+					}
+					
+					endpoints.emplace_back(Address(reinterpret_cast<sockaddr *>(&storage), size), domain, type, protocol);
+				}
+				
+				if (!valid || endpoints.empty()) continue;
+				
+				store(Key{host, service, socket_type}, endpoints, expires - now);
+				count += 1;
+			}
+			
+			return count;
+		}
+	}
+}
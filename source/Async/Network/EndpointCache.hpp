@@ -0,0 +1,114 @@
+//
+//  EndpointCache.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Resolver.hpp"
+
+#include <Concurrent/Fiber.hpp>
+
+#include <functional>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <tuple>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A thread-safe cache of resolved endpoints, keyed by host, service and socket type. Entries expire according to the TTL of the records they were resolved from. Stale entries can be served while they are refreshed in the background.
+		class EndpointCache
+		{
+		public:
+			typedef Resolver::TTL TTL;
+			typedef std::function<Endpoints(const std::string & host, const Service & service, Socket::Type socket_type, TTL * ttl)> Resolve;
+			
+			struct Options
+			{
+				Options() {}
+				
+				/// Used when the resolver does not supply a TTL, e.g. getaddrinfo.
+				TTL default_ttl = 60;
+				
+				TTL minimum_ttl = 1;
+				TTL maximum_ttl = 3600;
+				
+				/// How long a name which does not exist is remembered.
+				TTL negative_ttl = 5;
+				
+				/// How long after expiry an entry may still be served while it is refreshed.
+				TTL stale_ttl = 30;
+			};
+			
+			struct Statistics
+			{
+				std::size_t hits = 0;
+				std::size_t stale_hits = 0;
+				std::size_t negative_hits = 0;
+				std::size_t misses = 0;
+				std::size_t refreshes = 0;
+			};
+			
+			/// Resolve using the system resolver, Endpoint::named_endpoints.
+			EndpointCache(const Options & options = Options());
+			EndpointCache(Resolve resolve, const Options & options = Options());
+			
+			~EndpointCache();
+			
+			EndpointCache(const EndpointCache &) = delete;
+			EndpointCache & operator=(const EndpointCache &) = delete;
+			
+			/// Look up the endpoints, resolving them on a miss. If an entry is stale and a fiber pool is supplied, the stale endpoints are returned immediately and refreshed in a new fiber; otherwise the caller refreshes the entry.
+			Endpoints named_endpoints(const std::string & host, const Service & service, Socket::Type socket_type = SOCK_STREAM, Concurrent::Fiber::Pool * refresh = nullptr);
+			Endpoints named_endpoints(const URI::Generic & uri, Concurrent::Fiber::Pool * refresh = nullptr);
+			
+			/// Insert endpoints directly, e.g. from a resolver the caller manages.
+			void insert(const std::string & host, const Service & service, Socket::Type socket_type, const Endpoints & endpoints, TTL ttl);
+			
+			/// Remove all entries.
+			void clear();
+			std::size_t size() const;
+			
+			Statistics statistics() const;
+			
+			/// Write all live positive entries to a file, so a restarted process can start warm. Each entry records when it expires by the wall clock.
+			void save(const std::string & path) const;
+			
+			/// Load entries written by save, skipping any which have since expired and any malformed lines. Returns the number of entries loaded.
+			std::size_t load(const std::string & path);
+			
+		private:
+			typedef std::chrono::steady_clock Clock;
+			typedef std::tuple<std::string, std::string, Socket::Type> Key;
+			
+			struct Entry
+			{
+				Endpoints endpoints;
+				std::exception_ptr error;
+				
+				Clock::time_point expires;
+				bool refreshing = false;
+			};
+			
+			Endpoints resolve(const Key & key);
+			void store(const Key & key, const Endpoints & endpoints, TTL ttl);
+			void store_error(const Key & key, std::exception_ptr error);
+			
+			TTL clamp(TTL ttl) const;
+			
+			Resolve _resolve;
+			Options _options;
+			
+			mutable std::mutex _mutex;
+			std::map<Key, Entry> _entries;
+			
+			std::atomic<std::size_t> _hits{0}, _stale_hits{0}, _negative_hits{0}, _misses{0}, _refreshes{0};
+		};
+	}
+}
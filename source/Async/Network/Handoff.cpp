@@ -0,0 +1,291 @@
+//
+//  Handoff.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Handoff.hpp"
+#include "Server.hpp"
+
+#include <Async/Readable.hpp>
+#include <Async/Writable.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#include <sys/socket.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		constexpr std::size_t Handoff::MAXIMUM;
+		
+		namespace
+		{
+			const std::uint32_t MAGIC = 0x48414e44;
+			const char ACKNOWLEDGED = 'A';
+			
+#ifdef MSG_NOSIGNAL
+			const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+			const int SEND_FLAGS = 0;
+#endif
+			
+			struct Header
+			{
+				std::uint32_t magic;
+				std::uint32_t count;
+			};
+			
+			// Enough for every option SocketOptions can set:
+			const std::size_t MAXIMUM_SETTINGS = 16;
+			
+			struct Setting
+			{
+				std::int32_t level, name, value;
+				std::uint32_t inherited;
+			};
+			
+			// The endpoint which each socket in the SCM_RIGHTS message was bound to, in the same order, including its options so that the successor applies the same options to accepted sockets:
+			struct Record
+			{
+				std::int32_t domain, type, protocol;
+				std::uint32_t size;
+				sockaddr_storage address;
+				
+				std::uint32_t settings;
+				Setting setting[MAXIMUM_SETTINGS];
+			};
+			
+			// Send or receive the rest of a message which was only partially transferred.
+			void send_all(const Socket & channel, const char * data, std::size_t size, Reactor & reactor)
+			{
+				while (size > 0) {
+					auto result = ::send(channel, data, size, SEND_FLAGS);
+					
+					if (result >= 0) {
+						data += result;
+						size -= result;
+					} else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+						Writable(channel, reactor).wait();
+					} else if (errno != EINTR) {
+						throw std::system_error(errno, std::generic_category(), "send");
+					}
+				}
+			}
+			
+			bool receive_all(const Socket & channel, char * data, std::size_t size, Reactor & reactor)
+			{
+				while (size > 0) {
+					auto result = ::recv(channel, data, size, 0);
+					
+					if (result > 0) {
+						data += result;
+						size -= result;
+					} else if (result == 0) {
+						return false;
+					} else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+						Readable(channel, reactor).wait();
+					} else if (errno != EINTR) {
+						throw std::system_error(errno, std::generic_category(), "recv");
+					}
+				}
+				
+				return true;
+			}
+		}
+		
+		Handoff::Handoff(const Socket & channel, Reactor & reactor) : _channel(channel), _reactor(reactor)
+		{
+		}
+		
+		Handoff::~Handoff()
+		{
+		}
+		
+		void Handoff::send(const Endpoints & endpoints, const std::vector<Socket> & sockets)
+		{
+			if (endpoints.size() != sockets.size())
+				throw std::invalid_argument("Handoff requires one endpoint per socket!");
+			
+			if (sockets.empty() || sockets.size() > MAXIMUM)
+				throw std::invalid_argument("Handoff requires between 1 and 253 sockets!");
+			
+			for (auto & endpoint : endpoints) {
+				if (endpoint.options().size() > MAXIMUM_SETTINGS)
+					throw std::invalid_argument("Handoff supports at most 16 socket options per endpoint!");
+			}
+			
+			std::vector<char> buffer(sizeof(Header) + sizeof(Record) * sockets.size());
+			
+			Header header = {MAGIC, static_cast<std::uint32_t>(sockets.size())};
+			std::memcpy(buffer.data(), &header, sizeof(header));
+			
+			for (std::size_t i = 0; i < endpoints.size(); i += 1) {
+				auto & address = endpoints[i].address();
+				
+				Record record = {};
+				record.domain = endpoints[i].socket_domain();
+				record.type = endpoints[i].socket_type();
+				record.protocol = endpoints[i].socket_protocol();
+				record.size = address.size();
+				std::memcpy(&record.address, address.data(), address.size());
+				
+				for (auto & setting : endpoints[i].options().settings()) {
+					record.setting[record.settings++] = Setting{setting.level, setting.name, setting.value, setting.inherited};
+				}
+				
+				std::memcpy(buffer.data() + sizeof(Header) + sizeof(Record) * i, &record, sizeof(record));
+			}
+			
+			std::vector<char> control(CMSG_SPACE(sizeof(int) * sockets.size()));
+			
+			iovec vector = {buffer.data(), buffer.size()};
+			
+			msghdr message = {};
+			message.msg_iov = &vector;
+			message.msg_iovlen = 1;
+			message.msg_control = control.data();
+			message.msg_controllen = control.size();
+			
+			auto rights = CMSG_FIRSTHDR(&message);
+			rights->cmsg_level = SOL_SOCKET;
+			rights->cmsg_type = SCM_RIGHTS;
+			rights->cmsg_len = CMSG_LEN(sizeof(int) * sockets.size());
+			
+			for (std::size_t i = 0; i < sockets.size(); i += 1) {
+				int descriptor = sockets[i];
+				std::memcpy(CMSG_DATA(rights) + sizeof(int) * i, &descriptor, sizeof(int));
+			}
+			
+			while (true) {
+				auto result = ::sendmsg(_channel, &message, SEND_FLAGS);
+				
+				if (result >= 0) {
+					// The descriptors were passed with the first byte, so the rest can be sent normally:
+					send_all(_channel, buffer.data() + result, buffer.size() - result, _reactor);
+					break;
+				}
+				
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					Writable(_channel, _reactor).wait();
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "sendmsg(SCM_RIGHTS)");
+				}
+			}
+			
+			char acknowledgement = 0;
+			
+			if (!receive_all(_channel, &acknowledgement, 1, _reactor) || acknowledgement != ACKNOWLEDGED)
+				throw std::runtime_error("Successor did not acknowledge the handoff!");
+		}
+		
+		void Handoff::send(const Server & server)
+		{
+			send(server.endpoints(), server.sockets());
+		}
+		
+		std::vector<Socket> Handoff::receive(Endpoints & endpoints)
+		{
+			std::vector<char> buffer(sizeof(Header) + sizeof(Record) * MAXIMUM);
+			std::vector<char> control(CMSG_SPACE(sizeof(int) * MAXIMUM));
+			
+			iovec vector = {buffer.data(), buffer.size()};
+			
+			msghdr message = {};
+			message.msg_iov = &vector;
+			message.msg_iovlen = 1;
+			message.msg_control = control.data();
+			message.msg_controllen = control.size();
+			
+			int flags = 0;
+#ifdef MSG_CMSG_CLOEXEC
+			flags |= MSG_CMSG_CLOEXEC;
+#endif
+			
+			ssize_t result;
+			
+			while (true) {
+				result = ::recvmsg(_channel, &message, flags);
+				
+				if (result >= 0) break;
+				
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					Readable(_channel, _reactor).wait();
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "recvmsg(SCM_RIGHTS)");
+				}
+			}
+			
+			// Take ownership of the descriptors first, so they are closed if the message is invalid:
+			std::vector<Socket> sockets;
+			
+			for (auto header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header)) {
+				if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS) {
+					std::size_t count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+					
+					for (std::size_t i = 0; i < count; i += 1) {
+						int descriptor;
+						std::memcpy(&descriptor, CMSG_DATA(header) + sizeof(int) * i, sizeof(int));
+						
+						sockets.emplace_back(descriptor);
+					}
+				}
+			}
+			
+			if (result == 0)
+				throw std::runtime_error("Predecessor closed the channel before the handoff!");
+			
+			if (message.msg_flags & MSG_CTRUNC)
+				throw std::runtime_error("Handoff descriptors were truncated!");
+			
+			std::size_t received = result;
+			
+			if (received < sizeof(Header) && !receive_all(_channel, buffer.data() + received, sizeof(Header) - received, _reactor))
+				throw std::runtime_error("Predecessor closed the channel during the handoff!");
+			
+			Header header;
+			std::memcpy(&header, buffer.data(), sizeof(header));
+			
+			if (header.magic != MAGIC || header.count > MAXIMUM || header.count != sockets.size())
+				throw std::runtime_error("Invalid handoff message!");
+			
+			std::size_t size = sizeof(Header) + sizeof(Record) * header.count;
+			received = std::max(received, sizeof(Header));
+			
+			if (received < size && !receive_all(_channel, buffer.data() + received, size - received, _reactor))
+				throw std::runtime_error("Predecessor closed the channel during the handoff!");
+			
+			endpoints.clear();
+			
+			for (std::size_t i = 0; i < header.count; i += 1) {
+				Record record;
+				std::memcpy(&record, buffer.data() + sizeof(Header) + sizeof(Record) * i, sizeof(record));
+				
+				if (record.size > sizeof(record.address) || record.settings > MAXIMUM_SETTINGS)
+					throw std::runtime_error("Invalid handoff record!");
+				
+				SocketOptions options;
+				
+				for (std::size_t j = 0; j < record.settings; j += 1) {
+					auto & setting = record.setting[j];
+					options.set(SocketOptions::Setting{setting.level, setting.name, setting.value, setting.inherited != 0});
+				}
+				
+				Address address(reinterpret_cast<const sockaddr *>(&record.address), record.size);
+				endpoints.emplace_back(address, record.domain, record.type, record.protocol);
+				endpoints.back().set_options(options);
+			}
+			
+			send_all(_channel, &ACKNOWLEDGED, 1, _reactor);
+			
+			return sockets;
+		}
+	}
+}
@@ -0,0 +1,44 @@
+//
+//  Handoff.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Endpoint.hpp"
+
+namespace Async
+{
+	namespace Network
+	{
+		class Server;
+		
+		/// Passes listening sockets, and the endpoints they are bound to, to another process over a UNIX domain socket using SCM_RIGHTS. The successor adopts the sockets without binding, and both processes share the same listen backlogs, so a restart neither refuses connections nor loses those already queued.
+		///
+		/// The predecessor sends its listeners, and once the successor acknowledges them, stops accepting and drains its own connections, e.g. using Server::stop.
+		class Handoff
+		{
+		public:
+			/// The most sockets which can be passed in one message (SCM_MAX_FD).
+			static constexpr std::size_t MAXIMUM = 253;
+			
+			/// The channel is a connected UNIX domain socket, e.g. from Endpoint::unix_domain or Socket::pair.
+			Handoff(const Socket & channel, Reactor & reactor);
+			~Handoff();
+			
+			/// Send the listening sockets and their endpoints, then wait for the successor to acknowledge them. Throws std::runtime_error if the channel is closed first, in which case the caller should keep accepting.
+			void send(const Endpoints & endpoints, const std::vector<Socket> & sockets);
+			void send(const Server & server);
+			
+			/// Receive listening sockets, filling in their endpoints (including their options), and acknowledge them.
+			std::vector<Socket> receive(Endpoints & endpoints);
+			
+		private:
+			const Socket & _channel;
+			Reactor & _reactor;
+		};
+	}
+}
@@ -0,0 +1,126 @@
+//
+//  Histogram.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Async
+{
+	namespace Network
+	{
+		constexpr unsigned Histogram::SUB_BUCKET_BITS;
+		constexpr std::size_t Histogram::SUB_BUCKETS;
+		constexpr std::size_t Histogram::BUCKETS;
+		
+		namespace
+		{
+			const std::size_t HALF = Histogram::SUB_BUCKETS / 2;
+			
+			unsigned most_significant_bit(std::uint64_t value)
+			{
+				return 63 - __builtin_clzll(value);
+			}
+		}
+		
+		Histogram::Histogram()
+		{
+			_counts.fill(0);
+		}
+		
+		// Values below SUB_BUCKETS have a bucket each. Above that, the range [2^k, 2^(k+1)) is divided into SUB_BUCKETS / 2 buckets, by shifting the value right until it is in [SUB_BUCKETS / 2, SUB_BUCKETS).
+		std::size_t Histogram::index_for(std::uint64_t value) noexcept
+		{
+			if (value < SUB_BUCKETS) return value;
+			
+			auto shift = most_significant_bit(value) - SUB_BUCKET_BITS + 1;
+			
+			return shift * HALF + (value >> shift);
+		}
+		
+		std::uint64_t Histogram::lowest_value(std::size_t index) noexcept
+		{
+			if (index < SUB_BUCKETS) return index;
+			
+			auto shift = index / HALF - 1;
+			
+			return std::uint64_t(index - shift * HALF) << shift;
+		}
+		
+		std::uint64_t Histogram::highest_value(std::size_t index) noexcept
+		{
+			if (index < SUB_BUCKETS) return index;
+			
+			auto shift = index / HALF - 1;
+			
+			return ((std::uint64_t(index - shift * HALF) + 1) << shift) - 1;
+		}
+		
+		void Histogram::record(std::uint64_t value, std::uint64_t count) noexcept
+		{
+			_counts[index_for(value)] += count;
+			
+			_count += count;
+			_total += double(value) * count;
+			
+			if (value < _minimum) _minimum = value;
+			if (value > _maximum) _maximum = value;
+		}
+		
+		double Histogram::mean() const noexcept
+		{
+			return _count ? _total / _count : 0;
+		}
+		
+		std::uint64_t Histogram::percentile(double percentage) const noexcept
+		{
+			if (_count == 0) return 0;
+			
+			percentage = std::min(std::max(percentage, 0.0), 100.0);
+			
+			auto target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(percentage / 100.0 * _count)));
+			std::uint64_t total = 0;
+			
+			for (std::size_t index = 0; index < BUCKETS; index += 1) {
+				total += _counts[index];
+				
+				if (total >= target) {
+					return std::min(std::max(highest_value(index), _minimum), _maximum);
+				}
+			}
+			
+			return _maximum;
+		}
+		
+		Histogram & Histogram::operator+=(const Histogram & other) noexcept
+		{
+			for (std::size_t index = 0; index < BUCKETS; index += 1) {
+				_counts[index] += other._counts[index];
+			}
+			
+			_count += other._count;
+			_total += other._total;
+			
+			_minimum = std::min(_minimum, other._minimum);
+			_maximum = std::max(_maximum, other._maximum);
+			
+			return *this;
+		}
+		
+		void Histogram::clear() noexcept
+		{
+			_counts.fill(0);
+			
+			_count = 0;
+			_total = 0;
+			_minimum = ~std::uint64_t(0);
+			_maximum = 0;
+		}
+	}
+}
@@ -0,0 +1,66 @@
+//
+//  Histogram.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A histogram of non-negative integer values, e.g. microseconds, with log-linear buckets in the style of HdrHistogram. Each power of two range is split into equal sub-buckets, so any recorded value is reported within about 3% of its true value, using a fixed 15KB of memory and no allocation.
+		class Histogram
+		{
+		public:
+			static constexpr unsigned SUB_BUCKET_BITS = 6;
+			static constexpr std::size_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+			static constexpr std::size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) * (SUB_BUCKETS / 2) + SUB_BUCKETS / 2;
+			
+			Histogram();
+			
+			void record(std::uint64_t value, std::uint64_t count = 1) noexcept;
+			
+			std::uint64_t count() const noexcept {return _count;}
+			std::uint64_t minimum() const noexcept {return _count ? _minimum : 0;}
+			std::uint64_t maximum() const noexcept {return _maximum;}
+			double mean() const noexcept;
+			
+			/// The value below which the given percentage (0 to 100) of recorded values fall.
+			std::uint64_t percentile(double percentage) const noexcept;
+			
+			Histogram & operator+=(const Histogram & other) noexcept;
+			
+			void clear() noexcept;
+			
+			/// Invoke the callback with the lowest value, highest value and count of every bucket which has a non-zero count, in increasing order.
+			template <typename CallbackT>
+			void each(CallbackT callback) const
+			{
+				for (std::size_t index = 0; index < BUCKETS; index += 1) {
+					if (_counts[index]) callback(lowest_value(index), highest_value(index), _counts[index]);
+				}
+			}
+			
+			static std::size_t index_for(std::uint64_t value) noexcept;
+			static std::uint64_t lowest_value(std::size_t index) noexcept;
+			static std::uint64_t highest_value(std::size_t index) noexcept;
+			
+		private:
+			std::array<std::uint64_t, BUCKETS> _counts;
+			
+			std::uint64_t _count = 0;
+			std::uint64_t _minimum = ~std::uint64_t(0), _maximum = 0;
+			
+			/// The sum of all values, as a double to avoid overflow.
+			double _total = 0;
+		};
+	}
+}
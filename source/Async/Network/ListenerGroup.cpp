@@ -0,0 +1,110 @@
+//
+//  ListenerGroup.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ListenerGroup.hpp"
+
+#include <system_error>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <linux/filter.h>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+		ListenerGroup::ListenerGroup(const Endpoints & endpoints, std::size_t shards, std::size_t backlog) : _shards(shards)
+		{
+			if (shards == 0)
+				throw std::invalid_argument("Listener group requires at least one shard!");
+			
+			for (auto & endpoint : endpoints) {
+				// The first shard chooses the port, and the remaining shards join its reuse port group:
+				auto first = endpoint.bind();
+				first.listen(backlog);
+				
+				Endpoint bound(first.local_address(), endpoint.socket_domain(), endpoint.socket_type(), endpoint.socket_protocol());
+				bound.set_options(endpoint.options());
+				
+				_shards[0].push_back(std::move(first));
+				
+				for (std::size_t index = 1; index < shards; index += 1) {
+					auto socket = bound.bind();
+					socket.listen(backlog);
+					
+					_shards[index].push_back(std::move(socket));
+				}
+				
+				_endpoints.push_back(bound);
+			}
+		}
+		
+		ListenerGroup::~ListenerGroup()
+		{
+		}
+		
+		bool ListenerGroup::steer_by_cpu()
+		{
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+			// A = cpu; A = A % shards; return A
+			sock_filter code[] = {
+				{BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<__u32>(SKF_AD_OFF + SKF_AD_CPU)},
+				{BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<__u32>(_shards.size())},
+				{BPF_RET | BPF_A, 0, 0, 0},
+			};
+			
+			sock_fprog program = {sizeof(code) / sizeof(code[0]), code};
+			
+			// The program is shared by the whole reuse port group, so it only needs to be attached to one socket per endpoint:
+			for (auto & socket : _shards[0]) {
+				if (::setsockopt(socket, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)) == -1)
+					throw std::system_error(errno, std::generic_category(), "setsockopt(SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF)");
+			}
+			
+			return true;
+#else
+			return false;
+#endif
+		}
+		
+		bool ListenerGroup::set_incoming_cpu(std::size_t index, int cpu)
+		{
+#ifdef SO_INCOMING_CPU
+			for (auto & socket : _shards.at(index)) {
+				if (::setsockopt(socket, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu)) == -1)
+					throw std::system_error(errno, std::generic_category(), "setsockopt(SOL_SOCKET, SO_INCOMING_CPU)");
+			}
+			
+			return true;
+#else
+			return false;
+#endif
+		}
+		
+		bool ListenerGroup::pin_current_thread(int cpu)
+		{
+#ifdef __linux__
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cpu, &set);
+			
+			auto result = ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+			
+			if (result != 0)
+				throw std::system_error(result, std::generic_category(), "pthread_setaffinity_np");
+			
+			return true;
+#else
+			return false;
+#endif
+		}
+	}
+}
@@ -0,0 +1,48 @@
+//
+//  ListenerGroup.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Endpoint.hpp"
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Binds one listening socket per worker for each endpoint using SO_REUSEPORT, so that each worker can accept on its own socket with its own reactor, rather than every worker contending for a single socket.
+		class ListenerGroup
+		{
+		public:
+			/// Bind shards sockets to each endpoint. Endpoints with port 0 are bound to the port chosen for the first shard.
+			ListenerGroup(const Endpoints & endpoints, std::size_t shards, std::size_t backlog = SOMAXCONN);
+			~ListenerGroup();
+			
+			/// The number of shards, typically one per worker thread.
+			std::size_t shards() const {return _shards.size();}
+			
+			/// The listening sockets for the given shard, one per endpoint.
+			const std::vector<Socket> & shard(std::size_t index) const {return _shards.at(index);}
+			
+			/// The endpoints actually bound, with any port 0 replaced by the allocated port.
+			const Endpoints & endpoints() const {return _endpoints;}
+			
+			/// Steer each incoming connection to the shard with the same index as the CPU which received it, using a classic BPF program (SO_ATTACH_REUSEPORT_CBPF). Works best when worker N is pinned to CPU N, see pin_current_thread. Returns false if not supported by this platform.
+			bool steer_by_cpu();
+			
+			/// Prefer the given CPU for the sockets of a shard (SO_INCOMING_CPU). Returns false if not supported by this platform.
+			bool set_incoming_cpu(std::size_t index, int cpu);
+			
+			/// Pin the calling thread to the given CPU. Returns false if not supported by this platform.
+			static bool pin_current_thread(int cpu);
+			
+		private:
+			Endpoints _endpoints;
+			std::vector<std::vector<Socket>> _shards;
+		};
+	}
+}
@@ -0,0 +1,190 @@
+//
+//  Metrics.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Metrics.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+namespace Async
+{
+	namespace Network
+	{
+		constexpr bool Metrics::ENABLED;
+		constexpr std::size_t Metrics::ERROR_NUMBERS;
+		
+		std::uint64_t Metrics::Snapshot::errors_for(int number) const noexcept
+		{
+			if (number < 0) return 0;
+			
+			return errors[std::min<std::size_t>(number, ERROR_NUMBERS - 1)];
+		}
+		
+		const char * Metrics::name(Counter counter) noexcept
+		{
+			static const char * NAMES[COUNTERS] = {
+				"accepts", "accept_retries", "accept_waits",
+				"connects", "connect_waits",
+				"sends", "send_retries", "send_waits",
+				"receives", "receive_retries", "receive_waits",
+				"errors",
+			};
+			
+			return counter < COUNTERS ? NAMES[counter] : "unknown";
+		}
+		
+		const char * Metrics::name(Latency latency) noexcept
+		{
+			static const char * NAMES[LATENCIES] = {
+				"connect_wait", "accept_wait",
+			};
+			
+			return latency < LATENCIES ? NAMES[latency] : "unknown";
+		}
+
+#if ASYNC_NETWORK_METRICS
+		namespace
+		{
+			typedef std::atomic<std::uint64_t> Value;
+			
+			// Only the owning thread writes to its storage, so a relaxed load and store is enough, and avoids the cost of an atomic increment. Atomics are only used so that snapshots may read while the owner writes.
+			inline void add_to(Value & value, std::uint64_t amount = 1) noexcept
+			{
+				value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+			}
+			
+			struct Storage
+			{
+				std::array<Value, Metrics::COUNTERS> counters;
+				std::array<Value, Metrics::ERROR_NUMBERS> errors;
+				std::array<std::array<Value, Histogram::BUCKETS>, Metrics::LATENCIES> latencies;
+				
+				void accumulate(Metrics::Snapshot & snapshot) const
+				{
+					for (std::size_t index = 0; index < counters.size(); index += 1)
+						snapshot.counters[index] += counters[index].load(std::memory_order_relaxed);
+					
+					for (std::size_t index = 0; index < errors.size(); index += 1)
+						snapshot.errors[index] += errors[index].load(std::memory_order_relaxed);
+					
+					for (std::size_t latency = 0; latency < latencies.size(); latency += 1) {
+						for (std::size_t index = 0; index < Histogram::BUCKETS; index += 1) {
+							if (auto count = latencies[latency][index].load(std::memory_order_relaxed))
+								snapshot.latencies[latency].record(Histogram::lowest_value(index), count);
+						}
+					}
+				}
+			};
+			
+			struct Registry
+			{
+				std::mutex mutex;
+				std::vector<const Storage *> threads;
+				
+				/// The metrics of threads which have exited.
+				Metrics::Snapshot retired;
+			};
+			
+			// Never destroyed, as threads may exit after static destructors have run:
+			Registry & registry()
+			{
+				static Registry * registry = new Registry;
+				
+				return *registry;
+			}
+			
+			struct Registration
+			{
+				// Value initialised, so every counter starts at zero:
+				Storage * storage = new Storage();
+				
+				Registration()
+				{
+					try {
+						auto & registry = Network::registry();
+						std::lock_guard<std::mutex> guard(registry.mutex);
+						
+						registry.threads.push_back(storage);
+					} catch (...) {
+						delete storage;
+						
+						throw;
+					}
+				}
+				
+				~Registration()
+				{
+					auto & registry = Network::registry();
+					std::lock_guard<std::mutex> guard(registry.mutex);
+					
+					storage->accumulate(registry.retired);
+					registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), storage));
+					
+					delete storage;
+				}
+			};
+			
+			// Returns nullptr if the storage could not be allocated, in which case the next call tries again:
+			Storage * local() noexcept
+			{
+				try {
+					thread_local Registration registration;
+					
+					return registration.storage;
+				} catch (...) {
+					return nullptr;
+				}
+			}
+		}
+		
+		void Metrics::add(Counter counter) noexcept
+		{
+			if (auto storage = local())
+				add_to(storage->counters[counter]);
+		}
+		
+		void Metrics::add_error(int number) noexcept
+		{
+			if (auto storage = local()) {
+				add_to(storage->counters[ERRORS]);
+				add_to(storage->errors[std::min<std::size_t>(std::max(number, 0), ERROR_NUMBERS - 1)]);
+			}
+		}
+		
+		void Metrics::record(Latency latency, std::uint64_t microseconds) noexcept
+		{
+			if (auto storage = local())
+				add_to(storage->latencies[latency][Histogram::index_for(microseconds)]);
+		}
+		
+		Metrics::Snapshot Metrics::snapshot()
+		{
+			auto & registry = Network::registry();
+			std::lock_guard<std::mutex> guard(registry.mutex);
+			
+			Snapshot snapshot = registry.retired;
+			
+			for (auto storage : registry.threads)
+				storage->accumulate(snapshot);
+			
+			return snapshot;
+		}
+#else
+		void Metrics::add(Counter) noexcept {}
+		void Metrics::add_error(int) noexcept {}
+		void Metrics::record(Latency, std::uint64_t) noexcept {}
+		
+		Metrics::Snapshot Metrics::snapshot()
+		{
+			return Snapshot();
+		}
+#endif
+	}
+}
@@ -0,0 +1,121 @@
+//
+//  Metrics.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Histogram.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+/// Define as 0 to compile out all socket metrics. The library and everything using Metrics must agree.
+#ifndef ASYNC_NETWORK_METRICS
+#define ASYNC_NETWORK_METRICS 1
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Counters and wait latency histograms for socket operations. Each thread records into its own storage without locks or atomic read-modify-write, and a snapshot sums every thread's storage, so metrics from Parallel::Distributor workers are aggregated when read rather than when recorded. A thread's storage is allocated by its first record; if that allocation fails, the record is dropped rather than failing the socket operation.
+		class Metrics
+		{
+		public:
+			static constexpr bool ENABLED = ASYNC_NETWORK_METRICS;
+			
+			/// Retries are immediate re-attempts after a system call was interrupted (EINTR), while waits are for the reactor because the socket was not ready (EAGAIN).
+			enum Counter : std::size_t {
+				ACCEPTS, ACCEPT_RETRIES, ACCEPT_WAITS,
+				CONNECTS, CONNECT_WAITS,
+				SENDS, SEND_RETRIES, SEND_WAITS,
+				RECEIVES, RECEIVE_RETRIES, RECEIVE_WAITS,
+				ERRORS,
+				COUNTERS
+			};
+			
+			/// Time spent waiting on the reactor for an operation to complete, in microseconds.
+			enum Latency : std::size_t {
+				CONNECT_WAIT, ACCEPT_WAIT,
+				LATENCIES
+			};
+			
+			/// Errors are counted by errno, with larger values counted together in the last slot.
+			static constexpr std::size_t ERROR_NUMBERS = 256;
+			
+			struct Snapshot
+			{
+				std::array<std::uint64_t, COUNTERS> counters{};
+				std::array<std::uint64_t, ERROR_NUMBERS> errors{};
+				std::array<Histogram, LATENCIES> latencies;
+				
+				std::uint64_t operator[](Counter counter) const noexcept {return counters[counter];}
+				const Histogram & operator[](Latency latency) const noexcept {return latencies[latency];}
+				
+				std::uint64_t errors_for(int number) const noexcept;
+			};
+			
+			/// Sum the metrics of every thread, including threads which have exited. Histogram values are reported at bucket resolution.
+			static Snapshot snapshot();
+			
+			static const char * name(Counter counter) noexcept;
+			static const char * name(Latency latency) noexcept;
+			
+			static void increment(Counter counter) noexcept
+			{
+				if (ENABLED) add(counter);
+			}
+			
+			/// Count a failed operation by its errno.
+			static void error(int number) noexcept
+			{
+				if (ENABLED) add_error(number);
+			}
+			
+			/// Records the time from the first call to start() until destruction, if start() was called. Multiple waits for the same operation are recorded as one.
+			class Wait
+			{
+			public:
+				Wait(Latency latency) noexcept : _latency(latency) {}
+				
+				~Wait()
+				{
+#if ASYNC_NETWORK_METRICS
+					if (_started) {
+						auto duration = std::chrono::steady_clock::now() - _start;
+						record(_latency, std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+					}
+#endif
+				}
+				
+				void start() noexcept
+				{
+#if ASYNC_NETWORK_METRICS
+					if (!_started) {
+						_start = std::chrono::steady_clock::now();
+						_started = true;
+					}
+#endif
+				}
+				
+			private:
+				Latency _latency;
+
+#if ASYNC_NETWORK_METRICS
+				bool _started = false;
+				std::chrono::steady_clock::time_point _start;
+#endif
+			};
+			
+		private:
+			static void add(Counter counter) noexcept;
+			static void add_error(int number) noexcept;
+			static void record(Latency latency, std::uint64_t microseconds) noexcept;
+		};
+	}
+}
@@ -0,0 +1,126 @@
+//
+//  Registration.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Registration.hpp"
+
+#include <system_error>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+#ifdef __linux__
+		namespace
+		{
+			Descriptor create_events(Descriptor descriptor)
+			{
+				auto events = ::epoll_create1(EPOLL_CLOEXEC);
+				
+				if (events == -1)
+					throw std::system_error(errno, std::generic_category(), "epoll_create1");
+				
+				// Adding a socket which is already ready reports it immediately, so no edge is missed:
+				epoll_event event = {};
+				event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+				
+				if (::epoll_ctl(events, EPOLL_CTL_ADD, descriptor, &event) == -1) {
+					auto error = errno;
+					::close(events);
+					
+					throw std::system_error(error, std::generic_category(), "epoll_ctl");
+				}
+				
+				return events;
+			}
+		}
+		
+		Registration::Registration(Descriptor descriptor, Reactor & reactor) : _reactor(reactor), _events(create_events(descriptor)), _monitor(_events, reactor)
+		{
+		}
+		
+		Registration::~Registration()
+		{
+		}
+		
+		void Registration::update()
+		{
+			epoll_event event;
+			
+			if (::epoll_wait(_events, &event, 1, 0) <= 0) return;
+			
+			if (event.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) _readable = true;
+			if (event.events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) _writable = true;
+		}
+		
+		void Registration::wait(bool & ready)
+		{
+			// The operation failed with EAGAIN, so any earlier edge has been consumed. Any edge which arrived since is still queued in the private instance, which makes the monitor ready immediately:
+			ready = false;
+			
+			while (!ready) {
+				if (_polling) {
+					_updated.wait();
+					continue;
+				}
+				
+				_polling = true;
+				_waits += 1;
+				
+				try {
+					_monitor.wait();
+				} catch (...) {
+					_polling = false;
+					_updated.signal();
+					
+					throw;
+				}
+				
+				_polling = false;
+				
+				update();
+				_updated.signal();
+			}
+		}
+		
+		void Registration::wait_readable()
+		{
+			wait(_readable);
+		}
+		
+		void Registration::wait_writable()
+		{
+			wait(_writable);
+		}
+#else
+		Registration::Registration(Descriptor descriptor, Reactor & reactor) : _reactor(reactor), _readable(descriptor, reactor), _writable(descriptor, reactor)
+		{
+		}
+		
+		Registration::~Registration()
+		{
+		}
+		
+		void Registration::wait_readable()
+		{
+			_waits += 1;
+			_readable.wait();
+		}
+		
+		void Registration::wait_writable()
+		{
+			_waits += 1;
+			_writable.wait();
+		}
+#endif
+	}
+}
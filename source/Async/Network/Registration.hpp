@@ -0,0 +1,68 @@
+//
+//  Registration.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Async/Handle.hpp>
+#include <Async/Readable.hpp>
+#include <Async/Writable.hpp>
+#include <Concurrent/Condition.hpp>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A persistent registration of a socket with a reactor, used by Socket::attach. On Linux the socket is added once, edge-triggered for both reading and writing, to a private epoll instance, which is in turn registered once with the reactor. Readiness is tracked in user space, and a reader and writer may wait on the same socket at the same time.
+		///
+		/// Compared with a temporary Readable or Writable, each wait saves adding the socket to the reactor and removing it again (two epoll_ctl calls), but costs one non-blocking epoll_wait to read the new edges from the private instance. The reactor's own cost of waiting on the private instance is the same as for any monitor.
+		///
+		/// On other platforms, a readable and writable monitor are kept for the lifetime of the registration instead.
+		class Registration
+		{
+		public:
+			Registration(Descriptor descriptor, Reactor & reactor);
+			~Registration();
+			
+			Registration(const Registration &) = delete;
+			Registration & operator=(const Registration &) = delete;
+			
+			Reactor & reactor() const noexcept {return _reactor;}
+			
+			/// Wait for the socket to become readable or writable, after an operation on it failed with EAGAIN.
+			void wait_readable();
+			void wait_writable();
+			
+			/// The number of times a fiber waited on the reactor.
+			std::size_t waits() const noexcept {return _waits;}
+			
+		private:
+			Reactor & _reactor;
+			std::size_t _waits = 0;
+
+#ifdef __linux__
+			void wait(bool & ready);
+			
+			/// Read any new edges from the private epoll instance without waiting.
+			void update();
+			
+			/// The private epoll instance, which must outlive the monitor waiting on it.
+			Handle _events;
+			Readable _monitor;
+			
+			bool _readable = false, _writable = false;
+			
+			/// Whether a fiber is waiting on the monitor. Any other fibers wait for it to report new edges.
+			bool _polling = false;
+			Concurrent::Condition _updated;
+#else
+			Readable _readable;
+			Writable _writable;
+#endif
+		};
+	}
+}
@@ -0,0 +1,475 @@
+//
+//  Resolver.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Resolver.hpp"
+#include "Deadline.hpp"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+
+#include <system_error>
+#include <stdexcept>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+
+namespace Async
+{
+	namespace Network
+	{
+		namespace
+		{
+			const std::size_t MAXIMUM_PACKET_SIZE = 1232;
+			
+			const std::uint16_t TYPE_A = 1;
+			const std::uint16_t TYPE_AAAA = 28;
+			const std::uint16_t CLASS_IN = 1;
+			
+			const std::uint16_t FLAG_RESPONSE = 0x8000;
+			const std::uint16_t FLAG_TRUNCATED = 0x0200;
+			const std::uint16_t FLAG_RECURSION_DESIRED = 0x0100;
+			const std::uint16_t RCODE_MASK = 0x000F;
+			const std::uint16_t RCODE_NXDOMAIN = 3;
+			
+			void append_uint16(std::string & buffer, std::uint16_t value)
+			{
+				buffer.push_back(static_cast<char>(value >> 8));
+				buffer.push_back(static_cast<char>(value & 0xFF));
+			}
+			
+			std::uint16_t read_uint16(const unsigned char * data)
+			{
+				return (data[0] << 8) | data[1];
+			}
+			
+			std::uint32_t read_uint32(const unsigned char * data)
+			{
+				return (std::uint32_t(data[0]) << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+			}
+			
+			std::string query_for(std::uint16_t identifier, const std::string & host, std::uint16_t type)
+			{
+				std::string buffer;
+				buffer.reserve(18 + host.size());
+				
+				append_uint16(buffer, identifier);
+				append_uint16(buffer, FLAG_RECURSION_DESIRED);
+				append_uint16(buffer, 1); // QDCOUNT
+				append_uint16(buffer, 0); // ANCOUNT
+				append_uint16(buffer, 0); // NSCOUNT
+				append_uint16(buffer, 0); // ARCOUNT
+				
+				std::size_t offset = 0;
+				while (offset < host.size()) {
+					auto end = host.find('.', offset);
+					if (end == std::string::npos) end = host.size();
+					
+					auto length = end - offset;
+					if (length == 0 || length > 63)
+						throw std::invalid_argument("Invalid host name label!");
+					
+					buffer.push_back(static_cast<char>(length));
+					buffer.append(host, offset, length);
+					
+					offset = end + 1;
+				}
+				
+				buffer.push_back(0);
+				
+				append_uint16(buffer, type);
+				append_uint16(buffer, CLASS_IN);
+				
+				return buffer;
+			}
+			
+			// Skip over a (possibly compressed) domain name, returning the offset of the following field.
+			std::size_t skip_name(const unsigned char * data, std::size_t size, std::size_t offset)
+			{
+				while (offset < size) {
+					auto length = data[offset];
+					
+					if ((length & 0xC0) == 0xC0) {
+						return offset + 2;
+					} else if (length == 0) {
+						return offset + 1;
+					} else {
+						offset += 1 + length;
+					}
+				}
+				
+				throw std::runtime_error("Truncated name in DNS response!");
+			}
+			
+			// Returns the response code, appending any addresses in the answer section.
+			std::uint16_t parse_response(const unsigned char * data, std::size_t size, std::vector<Address> & addresses, Resolver::TTL & ttl)
+			{
+				if (size < 12)
+					throw std::runtime_error("Truncated DNS response!");
+				
+				auto flags = read_uint16(data + 2);
+				auto questions = read_uint16(data + 4);
+				auto answers = read_uint16(data + 6);
+				
+				std::size_t offset = 12;
+				
+				while (questions--) {
+					offset = skip_name(data, size, offset) + 4;
+				}
+				
+				while (answers--) {
+					offset = skip_name(data, size, offset);
+					
+					if (offset + 10 > size)
+						throw std::runtime_error("Truncated DNS record!");
+					
+					auto type = read_uint16(data + offset);
+					auto record_class = read_uint16(data + offset + 2);
+					auto record_ttl = read_uint32(data + offset + 4);
+					auto length = read_uint16(data + offset + 8);
+					
+					offset += 10;
+					
+					if (offset + length > size)
+						throw std::runtime_error("Truncated DNS record data!");
+					
+					if (record_class == CLASS_IN) {
+						if (type == TYPE_A && length == 4) {
+							sockaddr_in address = {};
+							address.sin_family = AF_INET;
+							std::memcpy(&address.sin_addr, data + offset, 4);
+							
+							addresses.emplace_back(reinterpret_cast<sockaddr *>(&address), sizeof(address));
+							ttl = std::min(ttl, record_ttl);
+						} else if (type == TYPE_AAAA && length == 16) {
+							sockaddr_in6 address = {};
+							address.sin6_family = AF_INET6;
+							std::memcpy(&address.sin6_addr, data + offset, 16);
+							
+							addresses.emplace_back(reinterpret_cast<sockaddr *>(&address), sizeof(address));
+							ttl = std::min(ttl, record_ttl);
+						}
+					}
+					
+					offset += length;
+				}
+				
+				return flags & RCODE_MASK;
+			}
+			
+			Address with_port(const Address & address, Port port)
+			{
+				Address result = address;
+				
+				if (result.family() == AF_INET) {
+					reinterpret_cast<sockaddr_in *>(result.data())->sin_port = htons(port);
+				} else if (result.family() == AF_INET6) {
+					reinterpret_cast<sockaddr_in6 *>(result.data())->sin6_port = htons(port);
+				}
+				
+				return result;
+			}
+			
+			bool numeric_address(const std::string & host, std::vector<Address> & addresses)
+			{
+				sockaddr_in address4 = {};
+				sockaddr_in6 address6 = {};
+				
+				if (inet_pton(AF_INET, host.c_str(), &address4.sin_addr) == 1) {
+					address4.sin_family = AF_INET;
+					addresses.emplace_back(reinterpret_cast<sockaddr *>(&address4), sizeof(address4));
+					
+					return true;
+				} else if (inet_pton(AF_INET6, host.c_str(), &address6.sin6_addr) == 1) {
+					address6.sin6_family = AF_INET6;
+					addresses.emplace_back(reinterpret_cast<sockaddr *>(&address6), sizeof(address6));
+					
+					return true;
+				}
+				
+				return false;
+			}
+		}
+		
+		Resolver::Resolver(Reactor & reactor) : Resolver(nameservers_for_path(), reactor)
+		{
+		}
+		
+		Resolver::Resolver(const Endpoints & nameservers, Reactor & reactor) : _reactor(reactor), _nameservers(nameservers)
+		{
+			std::random_device device;
+			_next_identifier = static_cast<std::uint16_t>(device());
+		}
+		
+		Resolver::~Resolver()
+		{
+		}
+		
+		void Resolver::set_timeout(Time::Interval timeout, std::size_t attempts)
+		{
+			if (timeout <= 0 || attempts == 0)
+				throw std::invalid_argument("Resolver requires a positive timeout and at least one attempt!");
+			
+			_timeout = timeout;
+			_attempts = attempts;
+		}
+		
+		Endpoints Resolver::nameservers_for_path(const char * path)
+		{
+			Endpoints nameservers;
+			std::ifstream input(path);
+			std::string line;
+			
+			while (std::getline(input, line)) {
+				std::istringstream fields(line);
+				std::string keyword, host;
+				
+				if (fields >> keyword >> host && keyword == "nameserver") {
+					std::vector<Address> addresses;
+					
+					if (numeric_address(host, addresses)) {
+						auto address = with_port(addresses.front(), 53);
+						nameservers.emplace_back(address, address.family(), SOCK_DGRAM, IPPROTO_UDP);
+					}
+				}
+			}
+			
+			if (nameservers.empty()) {
+				sockaddr_in address = {};
+				address.sin_family = AF_INET;
+				address.sin_port = htons(53);
+				address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+				
+				nameservers.emplace_back(Address(reinterpret_cast<sockaddr *>(&address), sizeof(address)), AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+			}
+			
+			return nameservers;
+		}
+		
+		Port Resolver::port_for_service(const Service & service, Socket::Type socket_type)
+		{
+			const auto & name = service.name();
+			char * end = nullptr;
+			
+			auto port = std::strtol(name.c_str(), &end, 10);
+			
+			if (!name.empty() && *end == '\0') {
+				return port;
+			}
+			
+			struct servent entry, * result = nullptr;
+			char buffer[1024];
+			
+			getservbyname_r(name.c_str(), socket_type == SOCK_DGRAM ? "udp" : "tcp", &entry, buffer, sizeof(buffer), &result);
+			
+			if (result == nullptr)
+				throw std::system_error(EAI_SERVICE, std::generic_category(), gai_strerror(EAI_SERVICE));
+			
+			return ntohs(result->s_port);
+		}
+		
+		Endpoints Resolver::named_endpoints(const std::string & host, const Service & service, Socket::Type socket_type, TTL * ttl)
+		{
+			auto port = port_for_service(service, socket_type);
+			auto protocol = socket_type == SOCK_DGRAM ? IPPROTO_UDP : IPPROTO_TCP;
+			
+			std::shared_ptr<Lookup> current;
+			
+			std::string key = host;
+			std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+			
+			if (!key.empty() && key.back() == '.') key.pop_back();
+			
+			auto pending = _pending.find(key);
+			
+			if (pending != _pending.end()) {
+				// Another fiber is already resolving this name, wait for its answer:
+				current = pending->second;
+				
+				while (!current->done) current->ready.wait();
+			} else {
+				current = std::make_shared<Lookup>();
+				
+				if (numeric_address(key, current->addresses)) {
+					current->ttl = ~TTL(0);
+				} else {
+					_pending.emplace(key, current);
+					
+					try {
+						lookup(key, *current);
+					} catch (...) {
+						current->error = std::current_exception();
+					}
+					
+					_pending.erase(key);
+					
+					current->done = true;
+					current->ready.signal();
+				}
+			}
+			
+			if (current->error)
+				std::rethrow_exception(current->error);
+			
+			if (ttl) *ttl = current->ttl;
+			
+			Endpoints endpoints;
+			endpoints.reserve(current->addresses.size());
+			
+			for (auto & address : current->addresses) {
+				endpoints.emplace_back(with_port(address, port), address.family(), socket_type, protocol);
+			}
+			
+			return endpoints;
+		}
+		
+		Endpoints Resolver::named_endpoints(const URI::Generic & uri, TTL * ttl)
+		{
+			Service service{uri.scheme};
+			if (!uri.port.empty())
+				service = uri.port;
+			
+			Socket::Type socket_type = SOCK_STREAM;
+			if (!uri.fragment.empty())
+				socket_type = Endpoint::socket_type_for_name(uri.fragment);
+			
+			return named_endpoints(uri.hostname(), service, socket_type, ttl);
+		}
+		
+		void Resolver::lookup(const std::string & host, Lookup & lookup)
+		{
+			std::exception_ptr error;
+			
+			for (auto & nameserver : _nameservers) {
+				try {
+					query(host, nameserver, lookup);
+					
+					return;
+				} catch (std::system_error & exception) {
+					// The name does not exist, asking another server won't help:
+					if (exception.code().value() == EAI_NONAME) throw;
+					
+					error = std::current_exception();
+				}
+			}
+			
+			if (error)
+				std::rethrow_exception(error);
+			else
+				throw std::system_error(EAI_FAIL, std::generic_category(), gai_strerror(EAI_FAIL));
+		}
+		
+		void Resolver::query(const std::string & host, const Endpoint & nameserver, Lookup & lookup)
+		{
+			Socket socket(nameserver.socket_domain(), SOCK_DGRAM, IPPROTO_UDP);
+			socket.connect(nameserver.address(), _reactor);
+			
+			std::uint16_t identifiers[2] = {_next_identifier++, _next_identifier++};
+			std::uint16_t types[2] = {TYPE_AAAA, TYPE_A};
+			
+			unsigned char buffer[MAXIMUM_PACKET_SIZE];
+			std::vector<Address> answers[2];
+			std::size_t outstanding = 2;
+			
+			// A server failure for one type doesn't invalidate the answer for the other:
+			bool failed = false;
+			
+			TTL ttl = ~TTL(0);
+			
+			for (std::size_t attempt = 0; attempt < _attempts && outstanding > 0; attempt += 1) {
+				// Send all outstanding queries before waiting, so they are answered in parallel. A lost query or answer is sent again on the next attempt:
+				for (std::size_t i = 0; i < 2; i += 1) {
+					if (types[i] == 0) continue;
+					
+					auto packet = query_for(identifiers[i], host, types[i]);
+					
+					if (::send(socket, packet.data(), packet.size(), 0) == -1)
+						throw std::system_error(errno, std::generic_category(), "send");
+					
+					_queries += 1;
+				}
+				
+				Deadline deadline(_timeout);
+				
+				while (outstanding > 0) {
+					auto size = ::recv(socket, buffer, sizeof(buffer), 0);
+					
+					if (size == -1) {
+						if (errno != EAGAIN && errno != EWOULDBLOCK)
+							throw std::system_error(errno, std::generic_category(), "recv");
+						
+						if (deadline.expired()) break;
+						
+						try {
+							deadline.wait_readable(socket, _reactor);
+						} catch (std::system_error & error) {
+							if (error.code().value() != ETIMEDOUT) throw;
+							
+							break;
+						}
+						
+						continue;
+					}
+					
+					if (size < 12) continue;
+					
+					auto identifier = read_uint16(buffer);
+					auto flags = read_uint16(buffer + 2);
+					
+					if ((flags & FLAG_RESPONSE) == 0) continue;
+					
+					for (std::size_t i = 0; i < 2; i += 1) {
+						if (identifier == identifiers[i] && types[i] != 0) {
+							std::vector<Address> addresses;
+							TTL answer_ttl = ttl;
+							std::uint16_t rcode;
+							
+							try {
+								rcode = parse_response(buffer, size, addresses, answer_ttl);
+							} catch (std::runtime_error &) {
+								// A malformed (or spoofed) reply is ignored, and we keep waiting for a valid one:
+								continue;
+							}
+							
+							if (flags & FLAG_TRUNCATED) {
+								// The answer didn't fit in a datagram and we don't retry over TCP, so a partial answer is treated as a failure rather than being mistaken for a complete one:
+								failed = true;
+							} else {
+								if (rcode != 0 && rcode != RCODE_NXDOMAIN) failed = true;
+								
+								answers[i] = std::move(addresses);
+								ttl = answer_ttl;
+							}
+							
+							types[i] = 0;
+							outstanding -= 1;
+						}
+					}
+				}
+			}
+			
+			// IPv6 answers are listed first, as getaddrinfo would:
+			lookup.addresses = std::move(answers[0]);
+			lookup.addresses.insert(lookup.addresses.end(), answers[1].begin(), answers[1].end());
+			lookup.ttl = ttl;
+			
+			if (lookup.addresses.empty()) {
+				// Without a complete answer, another server might know better:
+				if (failed || outstanding > 0)
+					throw std::system_error(EAI_AGAIN, std::generic_category(), gai_strerror(EAI_AGAIN));
+				
+				throw std::system_error(EAI_NONAME, std::generic_category(), gai_strerror(EAI_NONAME));
+			}
+		}
+	}
+}
@@ -0,0 +1,93 @@
+//
+//  Resolver.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Endpoint.hpp"
+
+#include <Time/Interval.hpp>
+
+#include <Concurrent/Condition.hpp>
+
+#include <map>
+#include <memory>
+#include <exception>
+#include <cstdint>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A non-blocking DNS stub resolver. Queries are sent over UDP sockets and the calling fiber waits on the reactor, so other fibers continue to run while a name is being resolved. Concurrent lookups of the same name share a single set of queries.
+		class Resolver
+		{
+		public:
+			/// Time to live of a resolved record, in seconds.
+			typedef std::uint32_t TTL;
+			
+			/// Use the name servers listed in /etc/resolv.conf.
+			Resolver(Reactor & reactor);
+			
+			/// Use the given name servers, in order of preference.
+			Resolver(const Endpoints & nameservers, Reactor & reactor);
+			
+			~Resolver();
+			
+			Resolver(const Resolver &) = delete;
+			Resolver & operator=(const Resolver &) = delete;
+			
+			const Endpoints & nameservers() const {return _nameservers;}
+			
+			/// Each query is sent up to attempts times to each name server, waiting up to timeout seconds for the answers each time, before trying the next name server. The defaults match resolv.conf.
+			void set_timeout(Time::Interval timeout, std::size_t attempts = 2);
+			
+			Time::Interval timeout() const noexcept {return _timeout;}
+			std::size_t attempts() const noexcept {return _attempts;}
+			
+			/// Resolve the host and service to a list of endpoints. If ttl is supplied, it is set to the smallest TTL of the records in the answer.
+			Endpoints named_endpoints(const std::string & host, const Service & service, Socket::Type socket_type = SOCK_STREAM, TTL * ttl = nullptr);
+			
+			Endpoints named_endpoints(const URI::Generic & uri, TTL * ttl = nullptr);
+			
+			/// The number of query packets sent so far.
+			std::size_t queries() const noexcept {return _queries;}
+			
+			/// Parse the name servers from a resolv.conf style file.
+			static Endpoints nameservers_for_path(const char * path = "/etc/resolv.conf");
+			
+			static Port port_for_service(const Service & service, Socket::Type socket_type);
+			
+		private:
+			struct Lookup
+			{
+				Concurrent::Condition ready;
+				bool done = false;
+				
+				std::vector<Address> addresses;
+				TTL ttl = 0;
+				
+				std::exception_ptr error;
+			};
+			
+			void lookup(const std::string & host, Lookup & lookup);
+			void query(const std::string & host, const Endpoint & nameserver, Lookup & lookup);
+			
+			Reactor & _reactor;
+			Endpoints _nameservers;
+			
+			Time::Interval _timeout = 5.0;
+			std::size_t _attempts = 2;
+			
+			std::uint16_t _next_identifier;
+			std::size_t _queries = 0;
+			
+			/// Lookups currently in flight, keyed by lower-case host name.
+			std::map<std::string, std::shared_ptr<Lookup>> _pending;
+		};
+	}
+}
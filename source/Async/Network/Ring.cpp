@@ -0,0 +1,554 @@
+//
+//  Ring.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Ring.hpp"
+
+#include <Async/Readable.hpp>
+
+#include <system_error>
+#include <stdexcept>
+#include <cstring>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Multishot accept and provided buffer rings were both added in Linux 5.19.
+#ifdef IORING_ACCEPT_MULTISHOT
+#define HAVE_IO_URING
+#endif
+#endif
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+#ifdef HAVE_IO_URING
+		namespace
+		{
+			int io_uring_setup(unsigned entries, io_uring_params * parameters)
+			{
+				return ::syscall(__NR_io_uring_setup, entries, parameters);
+			}
+			
+			int io_uring_enter(int descriptor, unsigned submit, unsigned complete, unsigned flags)
+			{
+				return ::syscall(__NR_io_uring_enter, descriptor, submit, complete, flags, nullptr, 0);
+			}
+			
+			int io_uring_register(int descriptor, unsigned operation, void * argument, unsigned count)
+			{
+				return ::syscall(__NR_io_uring_register, descriptor, operation, argument, count);
+			}
+			
+			void * map(std::size_t size, Descriptor descriptor, off_t offset)
+			{
+				auto address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, offset);
+				
+				if (address == MAP_FAILED)
+					throw std::system_error(errno, std::generic_category(), "mmap");
+				
+				return address;
+			}
+		}
+		
+		bool Ring::supported()
+		{
+			static const bool result = []{
+				io_uring_params parameters = {};
+				auto descriptor = io_uring_setup(2, &parameters);
+				
+				if (descriptor == -1) return false;
+				
+				// IORING_OP_SOCKET was added in the same release as multishot accept and provided buffer rings:
+				std::vector<char> buffer(sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op));
+				auto probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+				
+				bool available = io_uring_register(descriptor, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) == 0
+					&& probe->last_op >= IORING_OP_SOCKET
+					&& (probe->ops[IORING_OP_SOCKET].flags & IO_URING_OP_SUPPORTED);
+				
+				::close(descriptor);
+				
+				return available;
+			}();
+			
+			return result;
+		}
+		
+		Ring::Ring(Reactor & reactor, unsigned entries) : _reactor(reactor)
+		{
+			if (!supported()) return;
+			
+			io_uring_params parameters = {};
+			_descriptor = io_uring_setup(entries, &parameters);
+			
+			if (_descriptor == -1)
+				throw std::system_error(errno, std::generic_category(), "io_uring_setup");
+			
+			_submission_ring_size = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+			_completion_ring_size = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+			
+			if (parameters.features & IORING_FEAT_SINGLE_MMAP) {
+				_submission_ring_size = _completion_ring_size = std::max(_submission_ring_size, _completion_ring_size);
+				_submission_ring = _completion_ring = map(_submission_ring_size, _descriptor, IORING_OFF_SQ_RING);
+				_completion_ring_size = 0;
+			} else {
+				_submission_ring = map(_submission_ring_size, _descriptor, IORING_OFF_SQ_RING);
+				_completion_ring = map(_completion_ring_size, _descriptor, IORING_OFF_CQ_RING);
+			}
+			
+			_submission_entries_size = parameters.sq_entries * sizeof(io_uring_sqe);
+			_submission_entries = map(_submission_entries_size, _descriptor, IORING_OFF_SQES);
+			
+			auto submission = static_cast<char *>(_submission_ring);
+			_submission_head = reinterpret_cast<unsigned *>(submission + parameters.sq_off.head);
+			_submission_tail = reinterpret_cast<unsigned *>(submission + parameters.sq_off.tail);
+			_submission_mask = reinterpret_cast<unsigned *>(submission + parameters.sq_off.ring_mask);
+			_submission_array = reinterpret_cast<unsigned *>(submission + parameters.sq_off.array);
+			
+			auto completion = static_cast<char *>(_completion_ring);
+			_completion_head = reinterpret_cast<unsigned *>(completion + parameters.cq_off.head);
+			_completion_tail = reinterpret_cast<unsigned *>(completion + parameters.cq_off.tail);
+			_completion_mask = reinterpret_cast<unsigned *>(completion + parameters.cq_off.ring_mask);
+			_completion_entries = completion + parameters.cq_off.cqes;
+			
+			// The ring descriptor is readable when completions are available:
+			_fibers.reset(new Concurrent::Fiber::Pool);
+			_fibers->resume([this]{
+				Concurrent::Fiber::current->annotate("io_uring completions");
+				
+				Readable event(_descriptor, _reactor);
+				
+				while (true) {
+					if (complete() == 0) event.wait();
+				}
+			});
+		}
+		
+		Ring::~Ring()
+		{
+			if (_descriptor == -1) return;
+			
+			// Stop waiting on the descriptor while it is still open:
+			_fibers.reset();
+			
+			// Detach outstanding operations, so they don't touch the ring when they are destroyed:
+			for (auto & operation : _operations) {
+				operation.second->ring = nullptr;
+				operation.second->finished = true;
+			}
+			
+			_operations.clear();
+			
+			::munmap(_submission_entries, _submission_entries_size);
+			::munmap(_submission_ring, _submission_ring_size);
+			
+			if (_completion_ring_size)
+				::munmap(_completion_ring, _completion_ring_size);
+			
+			::close(_descriptor);
+		}
+		
+		void * Ring::prepare(Operation & operation)
+		{
+			auto entries = static_cast<io_uring_sqe *>(_submission_entries);
+			
+			auto tail = *_submission_tail;
+			auto index = tail & *_submission_mask;
+			
+			auto entry = &entries[index];
+			std::memset(entry, 0, sizeof(*entry));
+			entry->user_data = operation.identifier;
+			
+			_submission_array[index] = index;
+			
+			return entry;
+		}
+		
+		void Ring::submit()
+		{
+			__atomic_store_n(_submission_tail, *_submission_tail + 1, __ATOMIC_RELEASE);
+			
+			while (io_uring_enter(_descriptor, 1, 0, 0) == -1) {
+				if (errno == EINTR) continue;
+				
+				// The completion queue is full, so drain it and try again:
+				if (errno == EBUSY || errno == EAGAIN) {
+					complete();
+					continue;
+				}
+				
+				throw std::system_error(errno, std::generic_category(), "io_uring_enter");
+			}
+		}
+		
+		std::size_t Ring::complete()
+		{
+			auto entries = static_cast<io_uring_cqe *>(_completion_entries);
+			
+			auto head = *_completion_head;
+			auto tail = __atomic_load_n(_completion_tail, __ATOMIC_ACQUIRE);
+			
+			// Copy the completions out before resuming any fibers, as they may submit or complete operations themselves:
+			std::vector<std::pair<std::uint64_t, Completion>> completions;
+			completions.reserve(tail - head);
+			
+			for (; head != tail; head += 1) {
+				auto & entry = entries[head & *_completion_mask];
+				completions.push_back({entry.user_data, {entry.res, entry.flags}});
+			}
+			
+			__atomic_store_n(_completion_head, head, __ATOMIC_RELEASE);
+			
+			for (auto & completion : completions) {
+				auto iterator = _operations.find(completion.first);
+				
+				// The operation was abandoned, e.g. its fiber was stopped:
+				if (iterator == _operations.end()) continue;
+				
+				auto operation = iterator->second;
+				
+				operation->completions.push_back(completion.second);
+				
+				if ((completion.second.flags & IORING_CQE_F_MORE) == 0)
+					operation->finished = true;
+				
+				operation->ready.signal();
+			}
+			
+			return completions.size();
+		}
+		
+		Ring::Operation::Operation(Ring & ring) : ring(&ring), identifier(ring._next_identifier++)
+		{
+			ring._operations[identifier] = this;
+		}
+		
+		Ring::Operation::~Operation()
+		{
+			// The ring was destroyed first, and closing it cancelled the submission:
+			if (!ring) return;
+			
+			ring->_operations.erase(identifier);
+			
+			if (!finished) {
+				// Ask the kernel to cancel the submission. Its completion, and the cancellation's own, are discarded.
+				Operation cancel(*ring);
+				cancel.finished = true;
+				
+				auto entry = static_cast<io_uring_sqe *>(ring->prepare(cancel));
+				entry->opcode = IORING_OP_ASYNC_CANCEL;
+				entry->addr = identifier;
+				
+				try {
+					ring->submit();
+				} catch (...) {
+					// Destructors must not throw, and the completion will be ignored regardless.
+				}
+			}
+		}
+		
+		Ring::Completion Ring::Operation::wait()
+		{
+			while (completions.empty()) {
+				if (ring->complete() == 0 && completions.empty())
+					ready.wait();
+			}
+			
+			auto completion = completions.front();
+			completions.pop_front();
+			
+			return completion;
+		}
+		
+		Socket Ring::accept(const Socket & socket)
+		{
+			if (!enabled()) return socket.accept(_reactor);
+			
+			Operation operation(*this);
+			
+			auto entry = static_cast<io_uring_sqe *>(prepare(operation));
+			entry->opcode = IORING_OP_ACCEPT;
+			entry->fd = socket;
+			entry->accept_flags = SOCK_CLOEXEC | SOCK_NONBLOCK;
+			submit();
+			
+			auto completion = operation.wait();
+			
+			if (completion.result < 0)
+				throw std::system_error(-completion.result, std::generic_category(), "accept");
+			
+			return Socket(completion.result);
+		}
+		
+		void Ring::connect(Socket & socket, const Address & address)
+		{
+			if (!enabled()) return socket.connect(address, _reactor);
+			
+			Operation operation(*this);
+			
+			auto entry = static_cast<io_uring_sqe *>(prepare(operation));
+			entry->opcode = IORING_OP_CONNECT;
+			entry->fd = socket;
+			entry->addr = reinterpret_cast<std::uintptr_t>(address.data());
+			entry->off = address.size();
+			submit();
+			
+			auto completion = operation.wait();
+			
+			if (completion.result < 0)
+				throw std::system_error(-completion.result, std::generic_category(), "connect");
+		}
+		
+		std::size_t Ring::send(const Socket & socket, const void * data, std::size_t size)
+		{
+			if (!enabled()) {
+				const_cast<Socket &>(socket).send(data, size, _reactor);
+				return size;
+			}
+			
+			auto bytes = static_cast<const char *>(data);
+			std::size_t sent = 0;
+			
+			// The kernel may send less than requested, e.g. if interrupted, so keep going as Socket::send does:
+			while (sent < size) {
+				Operation operation(*this);
+				
+				auto entry = static_cast<io_uring_sqe *>(prepare(operation));
+				entry->opcode = IORING_OP_SEND;
+				entry->fd = socket;
+				entry->addr = reinterpret_cast<std::uintptr_t>(bytes + sent);
+				entry->len = size - sent;
+				entry->msg_flags = MSG_NOSIGNAL;
+				submit();
+				
+				auto completion = operation.wait();
+				
+				if (completion.result < 0)
+					throw std::system_error(-completion.result, std::generic_category(), "send");
+				
+				sent += completion.result;
+			}
+			
+			return size;
+		}
+		
+		std::size_t Ring::receive(const Socket & socket, void * data, std::size_t size)
+		{
+			if (!enabled()) return const_cast<Socket &>(socket).receive(data, size, _reactor);
+			
+			Operation operation(*this);
+			
+			auto entry = static_cast<io_uring_sqe *>(prepare(operation));
+			entry->opcode = IORING_OP_RECV;
+			entry->fd = socket;
+			entry->addr = reinterpret_cast<std::uintptr_t>(data);
+			entry->len = size;
+			submit();
+			
+			auto completion = operation.wait();
+			
+			if (completion.result < 0)
+				throw std::system_error(-completion.result, std::generic_category(), "recv");
+			
+			return completion.result;
+		}
+		
+		void Ring::accept_each(const Socket & socket, const Socket::AcceptCallback & callback)
+		{
+			if (!enabled()) {
+				while (true) callback(socket.accept(_reactor));
+			}
+			
+			Operation operation(*this);
+			
+			while (true) {
+				auto entry = static_cast<io_uring_sqe *>(prepare(operation));
+				entry->opcode = IORING_OP_ACCEPT;
+				entry->fd = socket;
+				entry->ioprio = IORING_ACCEPT_MULTISHOT;
+				entry->accept_flags = SOCK_CLOEXEC | SOCK_NONBLOCK;
+				
+				operation.finished = false;
+				submit();
+				
+				// One submission yields completions until the kernel stops it, e.g. on error:
+				do {
+					auto completion = operation.wait();
+					
+					if (completion.result >= 0) {
+						callback(Socket(completion.result));
+					} else if (-completion.result != ECONNABORTED && -completion.result != EINTR) {
+						throw std::system_error(-completion.result, std::generic_category(), "accept");
+					}
+				} while (!operation.finished || !operation.completions.empty());
+			}
+		}
+		
+		Ring::Buffers::Buffers(Ring & ring, std::uint16_t group, std::size_t count, std::size_t size) : _ring(ring), _group(group), _count(count), _size(size), _storage(count * size)
+		{
+			if (count == 0 || count > 32768 || (count & (count - 1)) != 0)
+				throw std::invalid_argument("Buffer count must be a power of two no larger than 32768!");
+			
+			if (!_ring.enabled()) return;
+			
+			_entries_size = count * sizeof(io_uring_buf);
+			_entries = ::mmap(nullptr, _entries_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+			
+			if (_entries == MAP_FAILED)
+				throw std::system_error(errno, std::generic_category(), "mmap");
+			
+			io_uring_buf_reg registration = {};
+			registration.ring_addr = reinterpret_cast<std::uintptr_t>(_entries);
+			registration.ring_entries = count;
+			registration.bgid = group;
+			
+			if (io_uring_register(_ring._descriptor, IORING_REGISTER_PBUF_RING, &registration, 1) == -1) {
+				auto error = errno;
+				::munmap(_entries, _entries_size);
+				
+				throw std::system_error(error, std::generic_category(), "io_uring_register(IORING_REGISTER_PBUF_RING)");
+			}
+			
+			for (std::size_t index = 0; index < count; index += 1)
+				recycle(index);
+		}
+		
+		Ring::Buffers::~Buffers()
+		{
+			if (!_entries) return;
+			
+			io_uring_buf_reg registration = {};
+			registration.bgid = _group;
+			
+			io_uring_register(_ring._descriptor, IORING_UNREGISTER_PBUF_RING, &registration, 1);
+			::munmap(_entries, _entries_size);
+		}
+		
+		void Ring::Buffers::recycle(std::uint16_t index)
+		{
+			if (!_entries) return;
+			
+			auto ring = static_cast<io_uring_buf_ring *>(_entries);
+			auto tail = ring->tail;
+			
+			auto & buffer = ring->bufs[tail & (_count - 1)];
+			buffer.addr = reinterpret_cast<std::uintptr_t>(data(index));
+			buffer.len = _size;
+			buffer.bid = index;
+			
+			__atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+		}
+		
+		std::size_t Ring::receive(const Socket & socket, Buffers & buffers, const ReceiveCallback & callback)
+		{
+			if (!enabled()) {
+				std::vector<char> buffer(buffers.size());
+				
+				auto size = const_cast<Socket &>(socket).receive(buffer.data(), buffer.size(), _reactor);
+				callback(buffer.data(), size);
+				
+				return size;
+			}
+			
+			Operation operation(*this);
+			
+			auto entry = static_cast<io_uring_sqe *>(prepare(operation));
+			entry->opcode = IORING_OP_RECV;
+			entry->fd = socket;
+			entry->flags = IOSQE_BUFFER_SELECT;
+			entry->buf_group = buffers.group();
+			entry->len = buffers.size();
+			submit();
+			
+			auto completion = operation.wait();
+			
+			if (completion.result < 0)
+				throw std::system_error(-completion.result, std::generic_category(), "recv");
+			
+			if (completion.flags & IORING_CQE_F_BUFFER) {
+				std::uint16_t index = completion.flags >> IORING_CQE_BUFFER_SHIFT;
+				
+				callback(buffers.data(index), completion.result);
+				buffers.recycle(index);
+			} else {
+				callback(nullptr, 0);
+			}
+			
+			return completion.result;
+		}
+#else
+		bool Ring::supported()
+		{
+			return false;
+		}
+		
+		Ring::Ring(Reactor & reactor, unsigned entries) : _reactor(reactor)
+		{
+		}
+		
+		Ring::~Ring()
+		{
+		}
+		
+		Socket Ring::accept(const Socket & socket)
+		{
+			return socket.accept(_reactor);
+		}
+		
+		void Ring::connect(Socket & socket, const Address & address)
+		{
+			socket.connect(address, _reactor);
+		}
+		
+		std::size_t Ring::send(const Socket & socket, const void * data, std::size_t size)
+		{
+			const_cast<Socket &>(socket).send(data, size, _reactor);
+			
+			return size;
+		}
+		
+		std::size_t Ring::receive(const Socket & socket, void * data, std::size_t size)
+		{
+			return const_cast<Socket &>(socket).receive(data, size, _reactor);
+		}
+		
+		void Ring::accept_each(const Socket & socket, const Socket::AcceptCallback & callback)
+		{
+			while (true) callback(socket.accept(_reactor));
+		}
+		
+		Ring::Buffers::Buffers(Ring & ring, std::uint16_t group, std::size_t count, std::size_t size) : _ring(ring), _group(group), _count(count), _size(size), _storage(count * size)
+		{
+		}
+		
+		Ring::Buffers::~Buffers()
+		{
+		}
+		
+		void Ring::Buffers::recycle(std::uint16_t index)
+		{
+		}
+		
+		std::size_t Ring::receive(const Socket & socket, Buffers & buffers, const ReceiveCallback & callback)
+		{
+			std::vector<char> buffer(buffers.size());
+			
+			auto size = const_cast<Socket &>(socket).receive(buffer.data(), buffer.size(), _reactor);
+			callback(buffer.data(), size);
+			
+			return size;
+		}
+#endif
+	}
+}
@@ -0,0 +1,144 @@
+//
+//  Ring.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Socket.hpp"
+
+#include <Concurrent/Condition.hpp>
+#include <Concurrent/Fiber.hpp>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A completion based backend for socket operations using io_uring. Operations are submitted to the kernel and the calling fiber is resumed when the completion arrives, so each operation costs one system call rather than a readiness wait followed by a separate system call. The ring's own descriptor is waited on through the reactor, so ring and readiness based operations can be mixed freely.
+		///
+		/// If io_uring is not available at run time (old kernel, or disabled by policy), every operation falls back to the readiness based implementation in Socket.
+		class Ring
+		{
+		public:
+			/// Whether io_uring (with multishot accept and provided buffer rings) is usable on this system.
+			static bool supported();
+			
+			Ring(Reactor & reactor, unsigned entries = 256);
+			
+			/// Operations still outstanding are abandoned: the kernel cancels them when the ring is closed, and their fibers stay blocked until they are stopped, e.g. by destroying their pool. Fibers using the ring should therefore be in a pool which is destroyed first.
+			~Ring();
+			
+			Ring(const Ring &) = delete;
+			Ring & operator=(const Ring &) = delete;
+			
+			/// Whether operations are submitted to io_uring, rather than using the readiness fallback.
+			bool enabled() const noexcept {return _descriptor != -1;}
+			
+			Socket accept(const Socket & socket);
+			void connect(Socket & socket, const Address & address);
+			
+			/// Send all of the data, returning size, as Socket::send. This may take several submissions if the kernel sends less than requested.
+			std::size_t send(const Socket & socket, const void * data, std::size_t size);
+			std::size_t receive(const Socket & socket, void * data, std::size_t size);
+			
+			/// Accept connections forever using a single multishot accept submission, passing each one to the callback.
+			void accept_each(const Socket & socket, const Socket::AcceptCallback & callback);
+			
+			/// A group of fixed size buffers shared with the kernel. A receive using the group is given a buffer by the kernel when data arrives, so idle connections don't each need their own buffer.
+			class Buffers
+			{
+			public:
+				Buffers(Ring & ring, std::uint16_t group, std::size_t count, std::size_t size);
+				~Buffers();
+				
+				Buffers(const Buffers &) = delete;
+				Buffers & operator=(const Buffers &) = delete;
+				
+				std::uint16_t group() const noexcept {return _group;}
+				std::size_t size() const noexcept {return _size;}
+				
+				const char * data(std::uint16_t index) const {return _storage.data() + index * _size;}
+				
+				/// Give a buffer back to the kernel once its data has been consumed.
+				void recycle(std::uint16_t index);
+				
+			private:
+				Ring & _ring;
+				
+				std::uint16_t _group;
+				std::size_t _count, _size;
+				
+				std::vector<char> _storage;
+				
+				/// The shared ring of buffer descriptors, page aligned.
+				void * _entries = nullptr;
+				std::size_t _entries_size = 0;
+			};
+			
+			typedef std::function<void(const char * data, std::size_t size)> ReceiveCallback;
+			
+			/// Receive into a buffer chosen by the kernel from the given group, passing the data to the callback before the buffer is recycled. Returns the number of bytes received, or 0 if the peer has shut down the connection.
+			std::size_t receive(const Socket & socket, Buffers & buffers, const ReceiveCallback & callback);
+			
+		private:
+			struct Completion
+			{
+				int result;
+				unsigned flags;
+			};
+			
+			/// An outstanding submission, which may produce several completions if it is multishot.
+			struct Operation
+			{
+				Operation(Ring & ring);
+				~Operation();
+				
+				Completion wait();
+				
+				/// Cleared if the ring is destroyed first, after which the operation does nothing.
+				Ring * ring;
+				std::uint64_t identifier;
+				
+				bool finished = false;
+				std::deque<Completion> completions;
+				Concurrent::Condition ready;
+			};
+			
+			/// Returns a zeroed submission entry, for the given operation.
+			void * prepare(Operation & operation);
+			void submit();
+			
+			/// Move completions from the kernel to their operations and resume any waiting fibers.
+			std::size_t complete();
+			
+			Reactor & _reactor;
+			Descriptor _descriptor = -1;
+			
+			void * _submission_ring = nullptr;
+			std::size_t _submission_ring_size = 0;
+			void * _completion_ring = nullptr;
+			std::size_t _completion_ring_size = 0;
+			void * _submission_entries = nullptr;
+			std::size_t _submission_entries_size = 0;
+			
+			unsigned * _submission_head = nullptr, * _submission_tail = nullptr, * _submission_mask = nullptr, * _submission_array = nullptr;
+			unsigned * _completion_head = nullptr, * _completion_tail = nullptr, * _completion_mask = nullptr;
+			void * _completion_entries = nullptr;
+			
+			std::uint64_t _next_identifier = 1;
+			std::map<std::uint64_t, Operation *> _operations;
+			
+			/// The fiber which waits for completions, stopped before the ring is unmapped.
+			std::unique_ptr<Concurrent::Fiber::Pool> _fibers;
+		};
+	}
+}
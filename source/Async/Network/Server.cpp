@@ -0,0 +1,262 @@
+//
+//  Server.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Server.hpp"
+
+#include <Async/After.hpp>
+#include <Async/Readable.hpp>
+#include <Async/Reactor.hpp>
+#include <Concurrent/Condition.hpp>
+#include <Concurrent/Fiber.hpp>
+
+#include <Time/Timer.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+#include <sys/socket.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		
+		namespace
+		{
+			// How often threads check whether the server has been stopped:
+			const Time::Interval POLL = 0.1;
+			
+			// The most connections accepted per wakeup:
+			const std::size_t BATCH = 64;
+			
+			// How long to stop accepting after running out of descriptors or memory. The listener stays readable, so retrying immediately would spin:
+			const Time::Interval BACKOFF = 0.01;
+			
+			bool is_exhausted(int error)
+			{
+				return error == EMFILE || error == ENFILE || error == ENOBUFS || error == ENOMEM;
+			}
+		}
+		
+		struct Server::Worker
+		{
+			std::size_t limit;
+			std::size_t connections = 0;
+			
+			// Signalled when a connection finishes, so saturated acceptors can continue:
+			Concurrent::Condition available;
+			
+			Fiber::Pool * fibers;
+		};
+		
+		Server::Server(const Endpoints & endpoints, Handler handler, std::size_t maximum_connections, std::size_t backlog) : _handler(handler), _maximum_connections(maximum_connections)
+		{
+			if (maximum_connections == 0)
+				throw std::invalid_argument("Server requires at least one connection!");
+			
+			for (auto & endpoint : endpoints) {
+				auto socket = endpoint.bind();
+				socket.listen(backlog);
+				
+				_endpoints.emplace_back(socket.local_address(), endpoint.socket_domain(), endpoint.socket_type(), endpoint.socket_protocol());
+				_endpoints.back().set_options(endpoint.options());
+				
+				_sockets.push_back(std::move(socket));
+			}
+		}
+		
+		Server::Server(const Endpoints & endpoints, std::vector<Socket> sockets, Handler handler, std::size_t maximum_connections) : _endpoints(endpoints), _sockets(std::move(sockets)), _handler(handler), _maximum_connections(maximum_connections)
+		{
+			if (maximum_connections == 0)
+				throw std::invalid_argument("Server requires at least one connection!");
+			
+			if (_endpoints.size() != _sockets.size())
+				throw std::invalid_argument("Server requires one endpoint per socket!");
+		}
+		
+		Server::~Server()
+		{
+			stop();
+		}
+		
+		void Server::start(std::size_t threads)
+		{
+			if (threads == 0)
+				throw std::invalid_argument("Server requires at least one thread!");
+			
+			if (!_threads.empty())
+				throw std::logic_error("Server is already running!");
+			
+			// Round down, but allow at least one connection per thread:
+			auto limit = std::max<std::size_t>(1, _maximum_connections / threads);
+			
+			_accepting = true;
+			
+			for (std::size_t i = 0; i < threads; i += 1) {
+				_threads.emplace_back([this, limit]{run(limit);});
+			}
+		}
+		
+		void Server::stop(Time::Interval drain)
+		{
+			_drain = drain;
+			_accepting = false;
+			
+			for (auto & thread : _threads) thread.join();
+			
+			_threads.clear();
+		}
+		
+		void Server::run(std::size_t limit)
+		{
+			Reactor reactor;
+			
+			Worker worker;
+			worker.limit = limit;
+			
+			// Connections are destroyed last, after the acceptors which create them, but before the worker which counts them:
+			Fiber::Pool fibers;
+			worker.fibers = &fibers;
+			
+			{
+				Fiber::Pool acceptors;
+				
+				for (std::size_t i = 0; i < _sockets.size(); i += 1) {
+					acceptors.resume([&, i]{
+						accept(_sockets[i], _endpoints[i], reactor, worker);
+					});
+				}
+				
+				while (_accepting) reactor.wait(POLL);
+			}
+			
+			Time::Timer timer;
+			
+			while (worker.connections > 0) {
+				auto remaining = _drain - timer.time();
+				
+				if (remaining <= 0) break;
+				
+				reactor.wait(std::min(remaining, POLL));
+			}
+		}
+		
+		void Server::accept(const Socket & socket, const Endpoint & endpoint, Reactor & reactor, Worker & worker)
+		{
+			// The listener stays registered with the reactor while accepting, as with Acceptor:
+			Readable event(socket, reactor);
+			
+			while (true) {
+				if (worker.connections >= worker.limit) {
+					_paused += 1;
+					
+					while (worker.connections >= worker.limit) {
+						// Leave the connections in the backlog, unless there are too many:
+						if (_shed_threshold) {
+							shed(socket, reactor);
+						} else {
+							worker.available.wait();
+						}
+					}
+				}
+				
+				std::size_t count;
+				
+				// The capacity is checked immediately before accepting, without waiting in between, so several listeners can't exceed the limit together:
+				try {
+					count = socket.accept_pending([&](Socket && peer){
+						try {
+							// As with Acceptor, options which are not inherited from the listener are set on each connection:
+							endpoint.options().apply_accepted(peer);
+						} catch (std::system_error &) {
+							// The peer went away, so it is closed without being handled.
+							return;
+						}
+						
+						auto connection = std::make_shared<Socket>(std::move(peer));
+						
+						worker.connections += 1;
+						_connections += 1;
+						_accepted += 1;
+						
+						worker.fibers->resume([this, connection, &reactor, &worker]{
+							struct Finished {
+								Server & server;
+								Worker & worker;
+								
+								~Finished() {
+									worker.connections -= 1;
+									server._connections -= 1;
+									worker.available.signal();
+								}
+							} finished{*this, worker};
+							
+							try {
+								_handler(*connection, reactor);
+							} catch (std::system_error &) {
+								// The peer went away.
+							}
+						});
+					}, std::min(BATCH, worker.limit - worker.connections));
+				} catch (std::system_error & error) {
+					if (!is_exhausted(error.code().value())) throw;
+					
+					// Connections accepted before the failure are already being handled, and the rest stay in the backlog until descriptors or memory are released:
+					_exhausted += 1;
+					After(BACKOFF, reactor).wait();
+					
+					continue;
+				}
+				
+				if (count == 0) event.wait();
+			}
+		}
+		
+		void Server::shed(const Socket & socket, Reactor & reactor)
+		{
+			auto depth = queued(socket);
+			
+			if (depth > _shed_threshold) {
+				_shed += socket.accept_pending([](Socket && peer){
+					// Reset the connection rather than closing it gracefully, so the client fails fast:
+					linger option = {1, 0};
+					::setsockopt(peer, SOL_SOCKET, SO_LINGER, &option, sizeof(option));
+				}, depth - _shed_threshold);
+			}
+			
+			After(_shed_interval, reactor).wait();
+		}
+		
+		std::size_t Server::queued(const Socket & socket)
+		{
+			try {
+				// For a listening socket, the kernel reports the length of the accept queue as unacknowledged:
+				return socket.transport_info().unacknowledged;
+			} catch (std::system_error &) {
+				return 0;
+			}
+		}
+		
+		std::size_t Server::queued() const
+		{
+			std::size_t total = 0;
+			
+			for (std::size_t i = 0; i < _sockets.size(); i += 1) {
+				auto & endpoint = _endpoints[i];
+				
+				if (endpoint.socket_domain() != AF_UNIX && endpoint.socket_type() == SOCK_STREAM)
+					total += queued(_sockets[i]);
+			}
+			
+			return total;
+		}
+	}
+}
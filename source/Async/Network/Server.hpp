@@ -0,0 +1,99 @@
+//
+//  Server.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Endpoint.hpp"
+
+#include <Time/Interval.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Listens on a set of endpoints and handles each connection in its own fiber, on a number of threads which each have their own reactor. The number of concurrent connections is bounded: a thread which is saturated stops accepting, so further connections wait in the listen backlog (or are accepted by another thread) rather than consuming memory. Each endpoint's options are applied to its listener, and those which are not inherited to every connection accepted from it.
+		class Server
+		{
+		public:
+			/// Handle a connection. The socket is closed when the handler returns. A std::system_error, e.g. because the peer went away, is ignored.
+			typedef std::function<void(Socket & peer, Reactor & reactor)> Handler;
+			
+			/// Bind and listen on every endpoint. Endpoints with port 0 are bound to an allocated port, see endpoints().
+			Server(const Endpoints & endpoints, Handler handler, std::size_t maximum_connections = 1024, std::size_t backlog = SOMAXCONN);
+			
+			/// Adopt sockets which are already listening, one per endpoint, e.g. from Handoff::receive, without binding.
+			Server(const Endpoints & endpoints, std::vector<Socket> sockets, Handler handler, std::size_t maximum_connections = 1024);
+			
+			/// Stops the server, abandoning any connections which are still being handled.
+			~Server();
+			
+			Server(const Server &) = delete;
+			Server & operator=(const Server &) = delete;
+			
+			/// The endpoints actually bound, one per listening socket.
+			const Endpoints & endpoints() const {return _endpoints;}
+			const std::vector<Socket> & sockets() const {return _sockets;}
+			
+			/// Start accepting on the given number of threads. Each thread handles at most maximum_connections / threads connections at a time.
+			void start(std::size_t threads = 1);
+			
+			/// Stop accepting, then wait up to drain seconds for connections which are being handled to finish, before abandoning them. The listening sockets stay open until the server is destroyed, so new connections queue rather than being refused.
+			void stop(Time::Interval drain = 0);
+			
+			/// While saturated, accept and reset connections beyond the given number waiting in the listen backlog, rather than leaving them to time out. The backlog is checked every shed_interval seconds. Disabled (0) by default. Requires TCP_INFO, see queued().
+			void set_shed_threshold(std::size_t threshold, Time::Interval shed_interval = 0.01) {_shed_threshold = threshold; _shed_interval = shed_interval;}
+			
+			std::size_t maximum_connections() const {return _maximum_connections;}
+			
+			/// Connections currently being handled.
+			std::size_t connections() const {return _connections;}
+			
+			/// Connections accepted since the server started.
+			std::size_t accepted() const {return _accepted;}
+			
+			/// The number of times a thread stopped accepting because it was saturated.
+			std::size_t paused() const {return _paused;}
+			
+			/// Connections accepted and immediately reset because the server was saturated, see set_shed_threshold.
+			std::size_t shed() const {return _shed;}
+			
+			/// The number of times accepting failed because the process or system ran out of descriptors or memory (EMFILE, ENFILE, ENOBUFS or ENOMEM). The thread stops accepting briefly and tries again, leaving the connections in the backlog.
+			std::size_t exhausted() const {return _exhausted;}
+			
+			/// Connections waiting in the listen backlogs of TCP endpoints, from TCP_INFO. Always 0 on platforms without it.
+			std::size_t queued() const;
+			
+		private:
+			struct Worker;
+			
+			void run(std::size_t limit);
+			void accept(const Socket & socket, const Endpoint & endpoint, Reactor & reactor, Worker & worker);
+			void shed(const Socket & socket, Reactor & reactor);
+			
+			static std::size_t queued(const Socket & socket);
+			
+			Endpoints _endpoints;
+			std::vector<Socket> _sockets;
+			
+			Handler _handler;
+			std::size_t _maximum_connections;
+			
+			std::size_t _shed_threshold = 0;
+			Time::Interval _shed_interval = 0.01;
+			
+			std::atomic<bool> _accepting{false};
+			Time::Interval _drain = 0;
+			std::vector<std::thread> _threads;
+			
+			std::atomic<std::size_t> _connections{0}, _accepted{0}, _paused{0}, _shed{0}, _exhausted{0};
+		};
+	}
+}
@@ -7,15 +7,38 @@
 //
 
 #include "Socket.hpp"
+#include "Deadline.hpp"
+#include "Metrics.hpp"
+#include "Registration.hpp"
 
 #include <sys/socket.h>
 #include <system_error>
+#include <stdexcept>
 
 #include <Async/After.hpp>
 #include <Async/Readable.hpp>
 #include <Async/Writable.hpp>
 
 #include <fcntl.h>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+#ifdef __linux__
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <netinet/tcp.h>
+
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif
 
 #if defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
 #define HAVE_ACCEPT4
@@ -26,6 +49,178 @@ namespace Async
 {
 	namespace Network
 	{
+		namespace
+		{
+			// An attached socket's registration can only be used by fibers on the same reactor:
+			Registration * registration_for(const std::shared_ptr<Registration> & registration, Reactor & reactor)
+			{
+				if (registration && &registration->reactor() == &reactor)
+					return registration.get();
+				
+				return nullptr;
+			}
+			
+			// Most operations complete without waiting, so the monitor is only created once it's needed, unless the socket has a persistent registration. A deadline, if given, bounds the wait instead.
+			void wait_readable(std::unique_ptr<Readable> & event, Descriptor descriptor, Reactor & reactor, const Deadline * deadline, Registration * registration)
+			{
+				if (deadline) {
+					deadline->wait_readable(descriptor, reactor);
+				} else if (registration) {
+					registration->wait_readable();
+				} else {
+					if (!event) event.reset(new Readable(descriptor, reactor));
+					
+					event->wait();
+				}
+			}
+			
+			void wait_writable(std::unique_ptr<Writable> & event, Descriptor descriptor, Reactor & reactor, const Deadline * deadline, Registration * registration)
+			{
+				if (deadline) {
+					deadline->wait_writable(descriptor, reactor);
+				} else if (registration) {
+					registration->wait_writable();
+				} else {
+					if (!event) event.reset(new Writable(descriptor, reactor));
+					
+					event->wait();
+				}
+			}
+			
+			Descriptor accept_connection(Descriptor descriptor, Reactor & reactor, const Deadline * deadline, Registration * registration)
+			{
+				std::unique_ptr<Readable> event;
+				Metrics::Wait wait(Metrics::ACCEPT_WAIT);
+				
+				sockaddr_storage storage;
+				sockaddr * data = reinterpret_cast<sockaddr *>(&storage);
+				socklen_t size = sizeof(storage);
+				
+				while (true) {
+#ifdef HAVE_ACCEPT4
+					auto result = ::accept4(descriptor, data, &size, SOCK_CLOEXEC | SOCK_NONBLOCK);
+#else
+					auto result = ::accept(descriptor, data, &size);
+#endif
+					
+					if (result == -1) {
+						if (errno == EINTR) {
+							Metrics::increment(Metrics::ACCEPT_RETRIES);
+							continue;
+						} else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+							Metrics::error(errno);
+							throw std::system_error(errno, std::generic_category(), "accept");
+						}
+					} else {
+#ifndef HAVE_ACCEPT4
+						update_flags(result, O_NONBLOCK | O_CLOEXEC);
+#endif
+						Metrics::increment(Metrics::ACCEPTS);
+						return result;
+					}
+					
+					Metrics::increment(Metrics::ACCEPT_WAITS);
+					wait.start();
+					
+					wait_readable(event, descriptor, reactor, deadline, registration);
+				}
+			}
+			
+			void send_buffers(Descriptor descriptor, const iovec * buffers, std::size_t count, Reactor & reactor, const Deadline * deadline, Registration * registration)
+			{
+				// Partial writes advance through a copy of the buffer list:
+				std::vector<iovec> remaining(buffers, buffers + count);
+				iovec * current = remaining.data();
+				
+				std::unique_ptr<Writable> event;
+				
+				int flags = 0;
+#ifdef MSG_NOSIGNAL
+				flags |= MSG_NOSIGNAL;
+#endif
+				
+				Metrics::increment(Metrics::SENDS);
+				
+				while (count > 0) {
+					msghdr message = {};
+					message.msg_iov = current;
+					message.msg_iovlen = count;
+					
+					auto result = ::sendmsg(descriptor, &message, flags);
+					
+					if (result == -1) {
+						if (errno == EAGAIN || errno == EWOULDBLOCK) {
+							Metrics::increment(Metrics::SEND_WAITS);
+							wait_writable(event, descriptor, reactor, deadline, registration);
+						} else if (errno == EINTR) {
+							Metrics::increment(Metrics::SEND_RETRIES);
+						} else {
+							Metrics::error(errno);
+							throw std::system_error(errno, std::generic_category(), "sendmsg");
+						}
+						
+						continue;
+					}
+					
+					std::size_t written = result;
+					
+					while (count > 0 && written >= current->iov_len) {
+						written -= current->iov_len;
+						current += 1;
+						count -= 1;
+					}
+					
+					if (count > 0) {
+						current->iov_base = static_cast<char *>(current->iov_base) + written;
+						current->iov_len -= written;
+					}
+				}
+			}
+			
+			std::size_t receive_buffers(Descriptor descriptor, const iovec * buffers, std::size_t count, Reactor & reactor, const Deadline * deadline, Registration * registration, Socket::Control * control = nullptr)
+			{
+				std::unique_ptr<Readable> event;
+				std::size_t capacity = control ? control->size : 0;
+				
+				Metrics::increment(Metrics::RECEIVES);
+				
+				while (true) {
+					msghdr message = {};
+					message.msg_iov = const_cast<iovec *>(buffers);
+					message.msg_iovlen = count;
+					
+					if (control) {
+						message.msg_control = control->data;
+						message.msg_controllen = capacity;
+					}
+					
+					auto result = ::recvmsg(descriptor, &message, 0);
+					
+					if (result >= 0) {
+						if (control) {
+							control->size = message.msg_controllen;
+							control->flags = message.msg_flags;
+						}
+						
+						return result;
+					}
+					
+					if (errno == EAGAIN || errno == EWOULDBLOCK) {
+						if (control && control->pending && control->pending())
+							continue;
+						
+						Metrics::increment(Metrics::RECEIVE_WAITS);
+						wait_readable(event, descriptor, reactor, deadline, registration);
+					} else if (errno == EINTR) {
+						Metrics::increment(Metrics::RECEIVE_RETRIES);
+					} else {
+						Metrics::error(errno);
+						throw std::system_error(errno, std::generic_category(), "recvmsg");
+					}
+				}
+			}
+		}
+		
 #ifdef HAVE_SOCKET_FLAGS
 		Socket::Socket(Domain domain, Type type, Protocol protocol) : Socket(::socket(domain, type | SOCK_NONBLOCK | SOCK_CLOEXEC, protocol))
 		{
@@ -41,7 +236,40 @@ namespace Async
 			update_flags(*this, O_NONBLOCK | O_CLOEXEC);
 		}
 #endif
-
+		
+		std::pair<Socket, Socket> Socket::pair(Type type)
+		{
+			Descriptor descriptors[2];
+			
+#ifdef HAVE_SOCKET_FLAGS
+			auto result = ::socketpair(AF_UNIX, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, descriptors);
+#else
+			auto result = ::socketpair(AF_UNIX, type, 0, descriptors);
+#endif
+			
+			if (result == -1)
+				throw std::system_error(errno, std::generic_category(), "socketpair");
+			
+			std::pair<Socket, Socket> sockets{Socket(descriptors[0]), Socket(descriptors[1])};
+			
+#ifndef HAVE_SOCKET_FLAGS
+			update_flags(sockets.first, O_NONBLOCK | O_CLOEXEC);
+			update_flags(sockets.second, O_NONBLOCK | O_CLOEXEC);
+#endif
+			
+			return sockets;
+		}
+		
+		void Socket::attach(Reactor & reactor)
+		{
+			_registration = std::make_shared<Registration>(_descriptor, reactor);
+		}
+		
+		void Socket::detach() noexcept
+		{
+			_registration.reset();
+		}
+		
 		Socket::Domain Socket::domain() const
 		{
 #ifdef __MACH__
@@ -138,6 +366,91 @@ namespace Async
 #endif
 		}
 		
+#ifdef __linux__
+		namespace
+		{
+			// The kernel's struct tcp_info, which has grown over time. The C library's definition is often older than the kernel, so the layout is given here up to the last field used. The kernel copies as much as both sides know about, and the rest is left zero.
+			struct KernelTransportInfo
+			{
+				std::uint8_t state, congestion_state, retransmits, probes, backoff, options, window_scale, flags;
+				
+				std::uint32_t retransmission_timeout, delayed_ack_timeout, send_maximum_segment_size, receive_maximum_segment_size;
+				std::uint32_t unacknowledged, selectively_acknowledged, lost, retransmitting, forward_acknowledged;
+				std::uint32_t last_data_sent, last_ack_sent, last_data_received, last_ack_received;
+				std::uint32_t path_mtu, receive_slow_start_threshold, round_trip_time, round_trip_time_variance, slow_start_threshold, congestion_window, advertised_maximum_segment_size, reordering;
+				std::uint32_t receive_round_trip_time, receive_space;
+				std::uint32_t total_retransmits;
+				
+				std::uint64_t pacing_rate, maximum_pacing_rate, bytes_acknowledged, bytes_received;
+				std::uint32_t segments_out, segments_in;
+				std::uint32_t not_sent, minimum_round_trip_time, data_segments_in, data_segments_out;
+				
+				std::uint64_t delivery_rate;
+			};
+			
+			Time::Interval microseconds(std::uint32_t value)
+			{
+				return value / 1e6;
+			}
+		}
+		
+		TransportInfo Socket::transport_info(Descriptor descriptor)
+		{
+			KernelTransportInfo kernel = {};
+			socklen_t size = sizeof(kernel);
+			
+			if (::getsockopt(descriptor, IPPROTO_TCP, TCP_INFO, &kernel, &size) == -1)
+				throw std::system_error(errno, std::generic_category(), "getsockopt(IPPROTO_TCP, TCP_INFO)");
+			
+			TransportInfo info;
+			
+			info.state = kernel.state;
+			info.round_trip_time = microseconds(kernel.round_trip_time);
+			info.round_trip_time_variance = microseconds(kernel.round_trip_time_variance);
+			info.minimum_round_trip_time = microseconds(kernel.minimum_round_trip_time);
+			info.receive_round_trip_time = microseconds(kernel.receive_round_trip_time);
+			info.retransmission_timeout = microseconds(kernel.retransmission_timeout);
+			
+			info.congestion_window = kernel.congestion_window;
+			info.slow_start_threshold = kernel.slow_start_threshold;
+			info.maximum_segment_size = kernel.send_maximum_segment_size;
+			
+			info.unacknowledged = kernel.unacknowledged;
+			info.lost = kernel.lost;
+			info.retransmitting = kernel.retransmitting;
+			info.total_retransmits = kernel.total_retransmits;
+			info.not_sent = kernel.not_sent;
+			
+			info.pacing_rate = kernel.pacing_rate;
+			info.delivery_rate = kernel.delivery_rate;
+			
+			return info;
+		}
+#else
+		TransportInfo Socket::transport_info(Descriptor descriptor)
+		{
+			throw std::system_error(ENOPROTOOPT, std::generic_category(), "TCP_INFO");
+		}
+#endif
+		
+		bool Socket::set_zero_copy(bool value)
+		{
+#ifdef SO_ZEROCOPY
+			int enable = value ? 1 : 0;
+			
+			if (::setsockopt(_descriptor, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) < 0) {
+				if (errno == ENOPROTOOPT || errno == EOPNOTSUPP)
+					return false;
+				
+				throw std::system_error(errno, std::generic_category(), "setsockopt(sockfd, SOL_SOCKET, SO_ZEROCOPY, ...)");
+			}
+			
+			return true;
+#else
+			return false;
+#endif
+		}
+		
 		void Socket::bind(const Address & address)
 		{
 			auto result = ::bind(_descriptor, address.data(), address.size());
@@ -156,57 +469,393 @@ namespace Async
 		
 		Socket Socket::accept(Reactor & reactor) const
 		{
-			Readable event(_descriptor, reactor);
-			
-			sockaddr_storage storage;
-			sockaddr * data = reinterpret_cast<sockaddr *>(&storage);
-			socklen_t size = sizeof(storage);
+			return accept_connection(_descriptor, reactor, nullptr, registration_for(_registration, reactor));
+		}
+		
+		Socket Socket::accept(Reactor & reactor, const Deadline & deadline) const
+		{
+			return accept_connection(_descriptor, reactor, &deadline, nullptr);
+		}
+		
+		std::size_t Socket::accept_pending(const AcceptCallback & callback, std::size_t limit) const
+		{
+			std::size_t count = 0;
 			
-			while (true) {
+			while (count < limit) {
 #ifdef HAVE_ACCEPT4
-				auto result = ::accept4(_descriptor, data, &size, SOCK_CLOEXEC | SOCK_NONBLOCK);
+				auto result = ::accept4(_descriptor, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
 #else
-				auto result = ::accept(_descriptor, data, &size);
+				auto result = ::accept(_descriptor, nullptr, nullptr);
 #endif
-
+				
 				if (result == -1) {
-					// std::cerr << "::accept(" << _descriptor << ", ...) -> " << result << " errno=" << errno << std::endl;
-					if (errno != EAGAIN && errno != EWOULDBLOCK)
-						throw std::system_error(errno, std::generic_category(), "accept");
-				} else {
+					if (errno == EAGAIN || errno == EWOULDBLOCK)
+						break;
+					
+					// The peer gave up before we accepted it, try the next one:
+					if (errno == ECONNABORTED || errno == EINTR)
+						continue;
+					
+					Metrics::error(errno);
+					throw std::system_error(errno, std::generic_category(), "accept");
+				}
+				
 #ifndef HAVE_ACCEPT4
-					update_flags(result, O_NONBLOCK | O_CLOEXEC);
+				update_flags(result, O_NONBLOCK | O_CLOEXEC);
 #endif
-					return result;
-				}
 				
-				// std::cerr << "::accept(" << _descriptor << ", ...) waiting..." << std::endl;
-				event.wait();
+				Metrics::increment(Metrics::ACCEPTS);
+				count += 1;
+				callback(Socket(result));
 			}
+			
+			return count;
 		}
 		
 		void Socket::connect(const Address & address, Reactor & reactor)
 		{
-			auto result = ::connect(_descriptor, address.data(), address.size());
+			Metrics::increment(Metrics::CONNECTS);
 			
-			// std::cerr << "::connect(...) -> " << result << std::endl;
+			auto result = ::connect(_descriptor, address.data(), address.size());
 			
 			if (result == -1) {
 				if (errno == EINPROGRESS) {
 					// connection in progress, wait to be writable.
-					Writable event(_descriptor, reactor);
+					Metrics::increment(Metrics::CONNECT_WAITS);
+					Metrics::Wait wait(Metrics::CONNECT_WAIT);
+					wait.start();
 					
-					event.wait();
+					if (auto registration = registration_for(_registration, reactor)) {
+						registration->wait_writable();
+					} else {
+						Writable(_descriptor, reactor).wait();
+					}
 					
 					check_errors();
-					// std::cerr << "::connect(...) -> connected" << std::endl;
 				} else {
-					// std::cerr << "::connect(...) -> " << result << errno << std::endl;
+					Metrics::error(errno);
+					throw std::system_error(errno, std::generic_category(), "connect");
+				}
+			}
+		}
+		
+		std::size_t Socket::connect(const Address & address, const void * data, std::size_t size, Reactor & reactor)
+		{
+#ifdef MSG_FASTOPEN
+			int flags = MSG_FASTOPEN;
+#ifdef MSG_NOSIGNAL
+			flags |= MSG_NOSIGNAL;
+#endif
+			
+			auto result = ::sendto(_descriptor, data, size, flags, address.data(), address.size());
+			
+			if (result >= 0) {
+				Metrics::increment(Metrics::CONNECTS);
+				
+				// The SYN carried some or all of the data:
+				std::size_t sent = result;
+				
+				if (sent < size)
+					send(static_cast<const char *>(data) + sent, size - sent, reactor);
+				
+				return sent;
+			} else if (errno == EINPROGRESS) {
+				// No cookie was cached, so the SYN only requested one:
+				Metrics::increment(Metrics::CONNECTS);
+				Metrics::increment(Metrics::CONNECT_WAITS);
+				
+				{
+					Metrics::Wait wait(Metrics::CONNECT_WAIT);
+					wait.start();
+					
+					if (auto registration = registration_for(_registration, reactor)) {
+						registration->wait_writable();
+					} else {
+						Writable(_descriptor, reactor).wait();
+					}
+				}
+				
+				check_errors();
+				
+				send(data, size, reactor);
+				
+				return 0;
+			} else if (errno != EOPNOTSUPP) {
+				Metrics::error(errno);
+				throw std::system_error(errno, std::generic_category(), "sendto(MSG_FASTOPEN)");
+			}
+			
+			// Fast open is disabled for clients (net.ipv4.tcp_fastopen), so the socket is still unconnected.
+#endif
+			
+			connect(address, reactor);
+			send(data, size, reactor);
+			
+			return 0;
+		}
+		
+		void Socket::connect(const Address & address, Reactor & reactor, const Deadline & deadline)
+		{
+			Metrics::increment(Metrics::CONNECTS);
+			
+			auto result = ::connect(_descriptor, address.data(), address.size());
+			
+			if (result == -1) {
+				if (errno != EINPROGRESS) {
+					Metrics::error(errno);
 					throw std::system_error(errno, std::generic_category(), "connect");
 				}
-			} else {
-				// std::cerr << "::connect(...) -> connected" << std::endl;
-				return;
+				
+				Metrics::increment(Metrics::CONNECT_WAITS);
+				Metrics::Wait wait(Metrics::CONNECT_WAIT);
+				wait.start();
+				
+				deadline.wait_writable(_descriptor, reactor);
+				
+				check_errors();
+			}
+		}
+		
+		void Socket::send(const iovec * buffers, std::size_t count, Reactor & reactor)
+		{
+			send_buffers(_descriptor, buffers, count, reactor, nullptr, registration_for(_registration, reactor));
+		}
+		
+		void Socket::send(const iovec * buffers, std::size_t count, Reactor & reactor, const Deadline & deadline)
+		{
+			send_buffers(_descriptor, buffers, count, reactor, &deadline, nullptr);
+		}
+		
+		void Socket::send(const void * data, std::size_t size, Reactor & reactor)
+		{
+			iovec buffer = {const_cast<void *>(data), size};
+			
+			send(&buffer, 1, reactor);
+		}
+		
+		void Socket::send(const void * data, std::size_t size, Reactor & reactor, const Deadline & deadline)
+		{
+			iovec buffer = {const_cast<void *>(data), size};
+			
+			send(&buffer, 1, reactor, deadline);
+		}
+		
+		std::size_t Socket::receive(const iovec * buffers, std::size_t count, Reactor & reactor)
+		{
+			return receive_buffers(_descriptor, buffers, count, reactor, nullptr, registration_for(_registration, reactor));
+		}
+		
+		std::size_t Socket::receive(const iovec * buffers, std::size_t count, Reactor & reactor, const Deadline & deadline)
+		{
+			return receive_buffers(_descriptor, buffers, count, reactor, &deadline, nullptr);
+		}
+		
+		std::size_t Socket::receive(const iovec * buffers, std::size_t count, Control & control, Reactor & reactor)
+		{
+			return receive_buffers(_descriptor, buffers, count, reactor, nullptr, registration_for(_registration, reactor), &control);
+		}
+		
+		std::size_t Socket::receive(const iovec * buffers, std::size_t count, Control & control, Reactor & reactor, const Deadline & deadline)
+		{
+			return receive_buffers(_descriptor, buffers, count, reactor, &deadline, nullptr, &control);
+		}
+		
+		std::size_t Socket::receive(void * data, std::size_t size, Reactor & reactor)
+		{
+			iovec buffer = {data, size};
+			
+			return receive(&buffer, 1, reactor);
+		}
+		
+		std::size_t Socket::receive(void * data, std::size_t size, Reactor & reactor, const Deadline & deadline)
+		{
+			iovec buffer = {data, size};
+			
+			return receive(&buffer, 1, reactor, deadline);
+		}
+		
+		void Socket::send_to(const void * data, std::size_t size, const Address & address, Reactor & reactor)
+		{
+			std::unique_ptr<Writable> event;
+			
+			while (true) {
+				auto result = ::sendto(_descriptor, data, size, 0, address.data(), address.size());
+				
+				if (result >= 0) return;
+				
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					wait_writable(event, _descriptor, reactor, nullptr, registration_for(_registration, reactor));
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "sendto");
+				}
+			}
+		}
+		
+		std::size_t Socket::receive_from(void * data, std::size_t size, Address & address, Reactor & reactor)
+		{
+			std::unique_ptr<Readable> event;
+			
+			while (true) {
+				socklen_t address_size = address.capacity();
+				auto result = ::recvfrom(_descriptor, data, size, 0, address.data(), &address_size);
+				
+				if (result >= 0) {
+					address.resize(address_size);
+					
+					return result;
+				}
+				
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					wait_readable(event, _descriptor, reactor, nullptr, registration_for(_registration, reactor));
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "recvfrom");
+				}
+			}
+		}
+		
+		bool Socket::set_receive_offload(bool value)
+		{
+#ifdef UDP_GRO
+			int enable = value ? 1 : 0;
+			
+			if (::setsockopt(_descriptor, IPPROTO_UDP, UDP_GRO, &enable, sizeof(enable)) < 0) {
+				if (errno == ENOPROTOOPT)
+					return false;
+				
+				throw std::system_error(errno, std::generic_category(), "setsockopt(sockfd, IPPROTO_UDP, UDP_GRO, ...)");
+			}
+			
+			return true;
+#else
+			return false;
+#endif
+		}
+		
+		void Socket::send_segments(const void * data, std::size_t size, std::size_t segment_size, const Address & address, Reactor & reactor)
+		{
+			if (segment_size == 0)
+				throw std::invalid_argument("Segment size must be at least 1!");
+			
+			auto bytes = static_cast<const char *>(data);
+			
+#ifdef UDP_SEGMENT
+			// The kernel limits the number of segments in one send (UDP_MAX_SEGMENTS), and the whole send must fit in one UDP payload:
+			const std::size_t maximum_segments = std::max<std::size_t>(1, std::min<std::size_t>(64, 65507 / segment_size));
+			
+			std::unique_ptr<Writable> event;
+			bool supported = true;
+			
+			while (size > 0 && supported) {
+				auto length = std::min(size, segment_size * maximum_segments);
+				
+				iovec buffer = {const_cast<char *>(bytes), length};
+				
+				char control[CMSG_SPACE(sizeof(std::uint16_t))] = {0};
+				
+				msghdr message = {};
+				message.msg_name = const_cast<sockaddr *>(address.data());
+				message.msg_namelen = address.size();
+				message.msg_iov = &buffer;
+				message.msg_iovlen = 1;
+				
+				// A single segment does not need offload:
+				if (length > segment_size) {
+					message.msg_control = control;
+					message.msg_controllen = sizeof(control);
+					
+					auto header = CMSG_FIRSTHDR(&message);
+					header->cmsg_level = IPPROTO_UDP;
+					header->cmsg_type = UDP_SEGMENT;
+					header->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+					
+					std::uint16_t value = segment_size;
+					std::memcpy(CMSG_DATA(header), &value, sizeof(value));
+				}
+				
+				auto result = ::sendmsg(_descriptor, &message, 0);
+				
+				if (result >= 0) {
+					bytes += length;
+					size -= length;
+				} else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					wait_writable(event, _descriptor, reactor, nullptr, registration_for(_registration, reactor));
+				} else if (errno == EIO || errno == EINVAL || errno == ENOPROTOOPT || errno == EMSGSIZE) {
+					// Segmentation offload is not available for this socket, device or size:
+					supported = false;
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "sendmsg(UDP_SEGMENT)");
+				}
+			}
+#endif
+			
+			while (size > 0) {
+				auto length = std::min(size, segment_size);
+				
+				send_to(bytes, length, address, reactor);
+				
+				bytes += length;
+				size -= length;
+			}
+		}
+		
+		std::size_t Socket::receive_segments(void * data, std::size_t size, Address & address, const SegmentCallback & callback, Reactor & reactor)
+		{
+			std::unique_ptr<Readable> event;
+			
+			iovec buffer = {data, size};
+			char control[CMSG_SPACE(sizeof(int))];
+			
+			while (true) {
+				msghdr message = {};
+				message.msg_name = address.data();
+				message.msg_namelen = address.capacity();
+				message.msg_iov = &buffer;
+				message.msg_iovlen = 1;
+				message.msg_control = control;
+				message.msg_controllen = sizeof(control);
+				
+				auto result = ::recvmsg(_descriptor, &message, 0);
+				
+				if (result >= 0) {
+					// Otherwise the last segment would be delivered short, as if it were a complete datagram:
+					if (message.msg_flags & MSG_TRUNC)
+						throw std::system_error(EMSGSIZE, std::generic_category(), "recvmsg");
+					
+					address.resize(message.msg_namelen);
+					
+					std::size_t segment_size = result;
+					
+#ifdef UDP_GRO
+					for (auto header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header)) {
+						if (header->cmsg_level == IPPROTO_UDP && header->cmsg_type == UDP_GRO) {
+							int value = 0;
+							std::memcpy(&value, CMSG_DATA(header), sizeof(value));
+							
+							if (value > 0) segment_size = value;
+						}
+					}
+#endif
+					
+					auto bytes = static_cast<const char *>(data);
+					std::size_t remaining = result, count = 0;
+					
+					do {
+						auto length = std::min(remaining, segment_size);
+						callback(bytes, length);
+						
+						bytes += length;
+						remaining -= length;
+						count += 1;
+					} while (remaining > 0);
+					
+					return count;
+				}
+				
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					wait_readable(event, _descriptor, reactor, nullptr, registration_for(_registration, reactor));
+				} else if (errno != EINTR) {
+					throw std::system_error(errno, std::generic_category(), "recvmsg");
+				}
 			}
 		}
 		
@@ -219,8 +868,10 @@ namespace Async
 			
 			if (result == -1)
 				throw std::system_error(errno, std::generic_category(), "getsockopt");
-			else if (error != 0)
+			else if (error != 0) {
+				Metrics::error(error);
 				throw std::system_error(error, std::generic_category(), "SO_ERROR");
+			}
 		}
 	}
 }
@@ -11,6 +11,13 @@
 #include <Async/Handle.hpp>
 
 #include "Address.hpp"
+#include "TransportInfo.hpp"
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <sys/uio.h>
 
 namespace Async
 {
@@ -18,6 +25,9 @@ namespace Async
 	
 	namespace Network
 	{
+		class Deadline;
+		class Registration;
+		
 		class Socket : public Handle
 		{
 		public:
@@ -35,12 +45,23 @@ namespace Async
 			
 			Socket(Domain domain, Type type, Protocol protocol = 0);
 			
-			Socket(const Socket &) = default;
-			Socket & operator=(const Socket &) = default;
+			/// Copies do not share the registration, see attach.
+			Socket(const Socket & other) : Handle(other) {}
+			Socket & operator=(const Socket & other) {Handle::operator=(other); _registration.reset(); return *this;}
 			
 			Socket(Socket &&) = default;
 			Socket & operator=(Socket &&) = default;
 			
+			/// A connected pair of UNIX domain sockets, e.g. for communicating with a child process or another thread.
+			static std::pair<Socket, Socket> pair(Type type = SOCK_STREAM);
+			
+			/// Register the socket with the reactor once, for the rest of its lifetime, rather than each time an operation has to wait. Operations waiting on this reactor then toggle interest in user space, without any system calls to update the reactor, and a reader and writer may wait at the same time. Operations waiting on any other reactor, or with a deadline, are unaffected.
+			void attach(Reactor & reactor);
+			void detach() noexcept;
+			
+			bool is_attached() const noexcept {return _registration != nullptr;}
+			const Registration * registration() const noexcept {return _registration.get();}
+			
 			Domain domain() const;
 			Type type() const;
 			Protocol protocol() const;
@@ -61,15 +82,87 @@ namespace Async
 			
 			void set_reuse_address(bool value = true);
 			
+			/// A snapshot of the connection's round trip time, congestion window, retransmits and pacing rate from TCP_INFO. Throws std::system_error(ENOPROTOOPT) on platforms without TCP_INFO.
+			TransportInfo transport_info() const {return transport_info(_descriptor);}
+			static TransportInfo transport_info(Descriptor descriptor);
+			
+			/// Allow sends with MSG_ZEROCOPY. Returns false if the platform or socket does not support it.
+			bool set_zero_copy(bool value = true);
+			
 			void bind(const Address & address);
 			void listen(std::size_t backlog = SOMAXCONN);
 			
 			void connect(const Address & address, Reactor & reactor);
 			
+			/// Connect, throwing std::system_error(ETIMEDOUT) if the deadline expires first. The connection attempt is abandoned, but only stops when the socket is closed.
+			void connect(const Address & address, Reactor & reactor, const Deadline & deadline);
+			
+			/// Connect and send data, using TCP Fast Open to carry the data in the SYN if the peer's cookie is cached. Otherwise the SYN requests a cookie for next time, and the data is sent once connected. Falls back to connect then send if fast open is not available. Returns the number of bytes carried in the SYN.
+			std::size_t connect(const Address & address, const void * data, std::size_t size, Reactor & reactor);
+			
 			Socket accept(Reactor & reactor) const;
+			Socket accept(Reactor & reactor, const Deadline & deadline) const;
+			
+			typedef std::function<void(Socket &&)> AcceptCallback;
+			
+			/// Accept up to limit connections which are already pending, without waiting. Returns the number of connections passed to the callback.
+			std::size_t accept_pending(const AcceptCallback & callback, std::size_t limit) const;
+			
+			/// Send all the given buffers, gathered into as few system calls as possible. The send is attempted before waiting on the reactor, which is only used if the socket buffer is full.
+			void send(const iovec * buffers, std::size_t count, Reactor & reactor);
+			void send(const void * data, std::size_t size, Reactor & reactor);
+			
+			void send(const iovec * buffers, std::size_t count, Reactor & reactor, const Deadline & deadline);
+			void send(const void * data, std::size_t size, Reactor & reactor, const Deadline & deadline);
+			
+			/// Receive into the given buffers, scattering the data across them in order. The receive is attempted before waiting on the reactor. Returns the number of bytes received, or 0 if the peer has shut down the connection.
+			std::size_t receive(const iovec * buffers, std::size_t count, Reactor & reactor);
+			std::size_t receive(void * data, std::size_t size, Reactor & reactor);
+			
+			std::size_t receive(const iovec * buffers, std::size_t count, Reactor & reactor, const Deadline & deadline);
+			std::size_t receive(void * data, std::size_t size, Reactor & reactor, const Deadline & deadline);
+			
+			/// Ancillary data received with the data, e.g. timestamps.
+			struct Control
+			{
+				void * data = nullptr;
+				
+				/// The size of the buffer, and once received, the size of the ancillary data.
+				std::size_t size = 0;
+				
+				/// The flags of the received message, e.g. MSG_CTRUNC if the buffer was too small.
+				int flags = 0;
+				
+				/// Called when nothing could be received, before waiting. Returning true retries the receive without waiting, e.g. once the socket's error queue has been drained, as it makes the socket readable without any data.
+				std::function<bool()> pending;
+			};
+			
+			/// Receive as above, along with any ancillary data.
+			std::size_t receive(const iovec * buffers, std::size_t count, Control & control, Reactor & reactor);
+			std::size_t receive(const iovec * buffers, std::size_t count, Control & control, Reactor & reactor, const Deadline & deadline);
+			
+			/// Send a single datagram to the given address.
+			void send_to(const void * data, std::size_t size, const Address & address, Reactor & reactor);
+			
+			/// Receive a single datagram, filling in the address of the sender. Returns the size of the datagram.
+			std::size_t receive_from(void * data, std::size_t size, Address & address, Reactor & reactor);
+			
+			/// Enable UDP generic receive offload (UDP_GRO), so the kernel may coalesce consecutive datagrams from the same peer. Returns false if not supported by this platform.
+			bool set_receive_offload(bool value = true);
+			
+			/// Send the buffer as consecutive datagrams of segment_size bytes (the last may be shorter), using UDP generic segmentation offload (UDP_SEGMENT) to send up to 64 segments per system call. Falls back to one datagram per system call if not supported.
+			void send_segments(const void * data, std::size_t size, std::size_t segment_size, const Address & address, Reactor & reactor);
+			
+			typedef std::function<void(const char * data, std::size_t size)> SegmentCallback;
+			
+			/// Receive one datagram, which may be several datagrams coalesced by receive offload, and pass each original datagram to the callback. Returns the number of datagrams. If the buffer is too small for the whole batch, nothing is passed to the callback and std::system_error(EMSGSIZE) is thrown, so the buffer should be at least 64KiB when receive offload is enabled.
+			std::size_t receive_segments(void * data, std::size_t size, Address & address, const SegmentCallback & callback, Reactor & reactor);
 			
 		protected:
 			void check_errors();
+			
+		private:
+			std::shared_ptr<Registration> _registration;
 		};
 	}
 }
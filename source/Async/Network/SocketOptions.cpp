@@ -0,0 +1,168 @@
+//
+//  SocketOptions.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SocketOptions.hpp"
+#include "Socket.hpp"
+
+#include <system_error>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		SocketOptions & SocketOptions::set(int level, int name, int value, bool inherited)
+		{
+			for (auto & setting : _settings) {
+				if (setting.level == level && setting.name == name) {
+					setting.value = value;
+					return *this;
+				}
+			}
+			
+			_settings.push_back(Setting{level, name, value, inherited});
+			
+			return *this;
+		}
+		
+		SocketOptions & SocketOptions::reuse_address(bool value)
+		{
+			set(SOL_SOCKET, SO_REUSEADDR, value);
+#ifdef SO_REUSEPORT
+			set(SOL_SOCKET, SO_REUSEPORT, value);
+#endif
+			
+			return *this;
+		}
+		
+		bool SocketOptions::has_reuse_address() const noexcept
+		{
+			for (auto & setting : _settings) {
+				if (setting.level == SOL_SOCKET && setting.name == SO_REUSEADDR) return true;
+			}
+			
+			return false;
+		}
+		
+		SocketOptions & SocketOptions::no_delay(bool value)
+		{
+			return set(IPPROTO_TCP, TCP_NODELAY, value);
+		}
+		
+		SocketOptions & SocketOptions::send_buffer(int size)
+		{
+			return set(SOL_SOCKET, SO_SNDBUF, size);
+		}
+		
+		SocketOptions & SocketOptions::receive_buffer(int size)
+		{
+			return set(SOL_SOCKET, SO_RCVBUF, size);
+		}
+		
+		SocketOptions & SocketOptions::keep_alive(bool value)
+		{
+			return set(SOL_SOCKET, SO_KEEPALIVE, value);
+		}
+		
+		SocketOptions & SocketOptions::quick_ack(bool value)
+		{
+#ifdef TCP_QUICKACK
+			return set(IPPROTO_TCP, TCP_QUICKACK, value, false);
+#else
+			return *this;
+#endif
+		}
+		
+		SocketOptions & SocketOptions::defer_accept(int seconds)
+		{
+#ifdef TCP_DEFER_ACCEPT
+			return set(IPPROTO_TCP, TCP_DEFER_ACCEPT, seconds);
+#else
+			return *this;
+#endif
+		}
+		
+		SocketOptions & SocketOptions::fast_open(int queue_length)
+		{
+#ifdef TCP_FASTOPEN
+			return set(IPPROTO_TCP, TCP_FASTOPEN, queue_length);
+#else
+			return *this;
+#endif
+		}
+		
+		SocketOptions & SocketOptions::fast_open_connect(bool value)
+		{
+#ifdef TCP_FASTOPEN_CONNECT
+			return set(IPPROTO_TCP, TCP_FASTOPEN_CONNECT, value);
+#else
+			return *this;
+#endif
+		}
+		
+		SocketOptions & SocketOptions::type_of_service(int value)
+		{
+			return set(IPPROTO_IP, IP_TOS, value);
+		}
+		
+		namespace
+		{
+			void set_option(Socket & socket, int level, int name, int value)
+			{
+				if (::setsockopt(socket, level, name, &value, sizeof(value)) == -1) {
+					// The headers may define options which the running kernel doesn't support:
+					if (errno == ENOPROTOOPT || errno == EOPNOTSUPP) return;
+					
+					throw std::system_error(errno, std::generic_category(), "setsockopt");
+				}
+			}
+			
+			bool is_reuse_option(int name)
+			{
+#ifdef SO_REUSEPORT
+				if (name == SO_REUSEPORT) return true;
+#endif
+				
+				return name == SO_REUSEADDR;
+			}
+		}
+		
+		void SocketOptions::apply(Socket & socket, int domain, int type) const
+		{
+			for (auto & setting : _settings) {
+				auto level = setting.level, name = setting.name;
+				
+#ifdef IPV6_TCLASS
+				// The traffic class is the IPv6 equivalent of the type of service:
+				if (level == IPPROTO_IP && name == IP_TOS && domain == AF_INET6) {
+					level = IPPROTO_IPV6;
+					name = IPV6_TCLASS;
+				}
+#endif
+				
+				if (level == IPPROTO_TCP && type != SOCK_STREAM) continue;
+				
+				// UNIX domain sockets have no ports to reuse, and only support socket level options:
+				if (domain == AF_UNIX && (level != SOL_SOCKET || is_reuse_option(name))) continue;
+				
+				set_option(socket, level, name, setting.value);
+			}
+		}
+		
+		void SocketOptions::apply_accepted(Socket & socket) const
+		{
+			for (auto & setting : _settings) {
+				if (!setting.inherited)
+					set_option(socket, setting.level, setting.name, setting.value);
+			}
+		}
+	}
+}
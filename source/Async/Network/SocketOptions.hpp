@@ -0,0 +1,90 @@
+//
+//  SocketOptions.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace Async
+{
+	namespace Network
+	{
+		class Socket;
+		
+		/// A set of socket options, applied to a socket before it is bound or connected. Only options which have been set are applied, one setsockopt each. Options which the platform does not define are ignored, as are options which the running kernel rejects as unknown (ENOPROTOOPT or EOPNOTSUPP), e.g. TCP_FASTOPEN_CONNECT on an older kernel. Any other failure throws std::system_error.
+		class SocketOptions
+		{
+		public:
+			SocketOptions() {}
+			
+			/// SO_REUSEADDR, and SO_REUSEPORT where available, as Socket::set_reuse_address.
+			SocketOptions & reuse_address(bool value = true);
+			
+			/// TCP_NODELAY: send small segments immediately rather than coalescing them.
+			SocketOptions & no_delay(bool value = true);
+			
+			/// SO_SNDBUF and SO_RCVBUF in bytes. These must be set before connecting or listening to affect the TCP window scale.
+			SocketOptions & send_buffer(int size);
+			SocketOptions & receive_buffer(int size);
+			
+			/// SO_KEEPALIVE.
+			SocketOptions & keep_alive(bool value = true);
+			
+			/// TCP_QUICKACK (Linux): acknowledge immediately rather than delaying. This is not inherited by accepted sockets, so it is applied to each one.
+			SocketOptions & quick_ack(bool value = true);
+			
+			/// TCP_DEFER_ACCEPT (Linux): only wake the listener once a connection has data, waiting up to the given number of seconds.
+			SocketOptions & defer_accept(int seconds);
+			
+			/// TCP_FASTOPEN: allow clients to send data in the SYN, keeping up to queue_length pending fast open requests. Set on listeners.
+			SocketOptions & fast_open(int queue_length = 256);
+			
+			/// TCP_FASTOPEN_CONNECT (Linux): connect returns immediately if a cookie is cached, and the first send is carried in the SYN. This lets existing connect then send code use fast open. Set on clients.
+			SocketOptions & fast_open_connect(bool value = true);
+			
+			/// IP_TOS for IPv4, or IPV6_TCLASS for IPv6, e.g. a DSCP value shifted left by 2.
+			SocketOptions & type_of_service(int value);
+			
+			bool empty() const noexcept {return _settings.empty();}
+			std::size_t size() const noexcept {return _settings.size();}
+			
+			/// Whether reuse_address has been set, either way.
+			bool has_reuse_address() const noexcept;
+			
+			/// Apply all options to a new socket of the given domain and type, before bind or connect. Options for a different protocol, e.g. TCP_NODELAY on a UDP or UNIX domain socket, are skipped.
+			void apply(Socket & socket, int domain, int type) const;
+			
+			/// Apply the options which an accepted socket does not inherit from its listener. This makes no system calls if there are none.
+			void apply_accepted(Socket & socket) const;
+			
+			/// A single option, as passed to setsockopt.
+			struct Setting
+			{
+				int level;
+				int name;
+				int value;
+				
+				/// Whether accepted sockets inherit this option from the listening socket.
+				bool inherited;
+			};
+			
+			/// The options which have been set, e.g. to pass them to another process.
+			const std::vector<Setting> & settings() const noexcept {return _settings;}
+			
+			/// Add or replace a setting, e.g. one received from another process.
+			SocketOptions & set(const Setting & setting) {return set(setting.level, setting.name, setting.value, setting.inherited);}
+			
+		private:
+			/// Add or replace the setting for the given option.
+			SocketOptions & set(int level, int name, int value, bool inherited = true);
+			
+			std::vector<Setting> _settings;
+		};
+	}
+}
@@ -0,0 +1,213 @@
+//
+//  Timestamping.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Timestamping.hpp"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <system_error>
+#include <ctime>
+
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+		namespace
+		{
+			Timestamping::Nanoseconds nanoseconds(const timespec & time)
+			{
+				return Timestamping::Nanoseconds(time.tv_sec) * 1000000000 + time.tv_nsec;
+			}
+		}
+		
+		Timestamping::Nanoseconds Timestamping::now() noexcept
+		{
+			timespec time;
+			clock_gettime(CLOCK_REALTIME, &time);
+			
+			return nanoseconds(time);
+		}
+		
+		Timestamping::Timestamping(Socket & socket, Reactor & reactor, bool acknowledged) : _socket(socket), _reactor(reactor)
+		{
+			_stream = _socket.type() == SOCK_STREAM;
+
+#ifdef SO_TIMESTAMPING
+			unsigned flags = SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_TX_SCHED | SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+			
+			if (acknowledged && _stream) {
+				flags |= SOF_TIMESTAMPING_TX_ACK;
+				_final = ACKNOWLEDGED;
+			}
+			
+			// Identifiers count from zero, starting with the next send:
+			if (::setsockopt(_socket, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == -1)
+				throw std::system_error(errno, std::generic_category(), "setsockopt(SO_TIMESTAMPING)");
+			
+			_enabled = true;
+#endif
+		}
+		
+		Timestamping::~Timestamping()
+		{
+		}
+		
+		std::uint32_t Timestamping::send(const void * data, std::size_t size)
+		{
+			_socket.send(data, size, _reactor);
+			
+			if (_stream) {
+				_offset += size;
+				
+				if (_enabled) _sends.push_back(_offset - 1);
+				
+				return _offset - 1;
+			} else {
+				return _offset++;
+			}
+		}
+		
+		std::size_t Timestamping::receive(void * data, std::size_t size, Nanoseconds & received)
+		{
+			return receive(data, size, received, nullptr);
+		}
+		
+		std::size_t Timestamping::receive(void * data, std::size_t size, Nanoseconds & received, const Deadline & deadline)
+		{
+			return receive(data, size, received, &deadline);
+		}
+		
+		std::size_t Timestamping::receive(void * data, std::size_t size, Nanoseconds & received, const Deadline * deadline)
+		{
+			received = 0;
+			
+			iovec buffer = {data, size};
+			char control[256];
+			
+			Socket::Control ancillary;
+			ancillary.data = control;
+			ancillary.size = sizeof(control);
+			
+			// Pending send timestamps make the socket report an error, which would wake the reactor repeatedly:
+			ancillary.pending = [this]{return collect() > 0;};
+			
+			auto result = deadline ? _socket.receive(&buffer, 1, ancillary, _reactor, *deadline) : _socket.receive(&buffer, 1, ancillary, _reactor);
+			
+#ifdef SO_TIMESTAMPING
+			msghdr message = {};
+			message.msg_control = control;
+			message.msg_controllen = ancillary.size;
+			
+			for (auto header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header)) {
+				if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_TIMESTAMPING) {
+					auto timestamps = reinterpret_cast<const scm_timestamping *>(CMSG_DATA(header));
+					
+					// The software timestamp is first, and the raw hardware timestamp last:
+					received = nanoseconds(timestamps->ts[0]);
+					if (!received) received = nanoseconds(timestamps->ts[2]);
+				}
+			}
+#endif
+			
+			return result;
+		}
+		
+		std::size_t Timestamping::collect()
+		{
+			std::size_t count = 0;
+
+#ifdef SO_TIMESTAMPING
+			char control[256];
+			
+			while (true) {
+				msghdr message = {};
+				message.msg_control = control;
+				message.msg_controllen = sizeof(control);
+				
+				auto result = ::recvmsg(_socket, &message, MSG_ERRQUEUE);
+				
+				if (result == -1) {
+					if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+						break;
+					
+					throw std::system_error(errno, std::generic_category(), "recvmsg(MSG_ERRQUEUE)");
+				}
+				
+				// Each message has the timestamps, followed by the extended error which says which send and stage they are for:
+				Nanoseconds time = 0;
+				
+				for (auto header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header)) {
+					if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_TIMESTAMPING) {
+						auto timestamps = reinterpret_cast<const scm_timestamping *>(CMSG_DATA(header));
+						
+						time = nanoseconds(timestamps->ts[0]);
+						if (!time) time = nanoseconds(timestamps->ts[2]);
+					} else if ((header->cmsg_level == IPPROTO_IP && header->cmsg_type == IP_RECVERR) || (header->cmsg_level == IPPROTO_IPV6 && header->cmsg_type == IPV6_RECVERR)) {
+						auto error = reinterpret_cast<const sock_extended_err *>(CMSG_DATA(header));
+						
+						if (error->ee_errno != ENOMSG || error->ee_origin != SO_EE_ORIGIN_TIMESTAMPING)
+							continue;
+						
+						Stage stage;
+						
+						if (error->ee_info == SCM_TSTAMP_SCHED) stage = SCHEDULED;
+						else if (error->ee_info == SCM_TSTAMP_SND) stage = SENT;
+						else if (error->ee_info == SCM_TSTAMP_ACK) stage = ACKNOWLEDGED;
+						else continue;
+						
+						if (!complete(error->ee_data, stage))
+							continue;
+						
+						_completions.push_back({error->ee_data, stage, time});
+						count += 1;
+					}
+				}
+			}
+#endif
+			
+			return count;
+		}
+		
+		bool Timestamping::complete(std::uint32_t identifier, Stage stage)
+		{
+			// Datagrams are always sent by a single system call:
+			if (!_stream) return true;
+			
+			// Identifiers wrap around, so they are compared by their distance:
+			auto before = [](std::uint32_t a, std::uint32_t b){return static_cast<std::int32_t>(a - b) < 0;};
+			
+			// Find the send which the byte belongs to:
+			auto send = _sends.begin();
+			while (send != _sends.end() && before(*send, identifier)) ++send;
+			
+			if (send == _sends.end() || *send != identifier)
+				return false;
+			
+			// Each stage is reported in order, so once the final stage has been reported for a send, it has also been reported for the sends before it:
+			if (stage == _final)
+				_sends.erase(_sends.begin(), send + 1);
+			
+			return true;
+		}
+		
+				bool Timestamping::pop(Completion & completion)
+		{
+			if (_completions.empty()) return false;
+			
+			completion = _completions.front();
+			_completions.pop_front();
+			
+			return true;
+		}
+	}
+}
@@ -0,0 +1,99 @@
+//
+//  Timestamping.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Socket.hpp"
+
+#include <deque>
+#include <cstdint>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Reports when the kernel handled the data sent and received on a connected socket, using SO_TIMESTAMPING (Linux). Receive timestamps arrive with the data, and send timestamps are read from the socket error queue after the send, so latency can be split between the kernel, the reactor wakeup and the application.
+		///
+		/// Timestamps are software timestamps from CLOCK_REALTIME, comparable with now(). Hardware timestamps are only reported by network interfaces which have been configured for them (SIOCSHWTSTAMP), which loopback does not support.
+		class Timestamping
+		{
+		public:
+			typedef std::int64_t Nanoseconds;
+			
+			/// The current time from the same clock as the kernel's timestamps.
+			static Nanoseconds now() noexcept;
+			
+			enum Stage : std::uint8_t {
+				/// The data entered the packet scheduler (queueing discipline).
+				SCHEDULED,
+				/// The data was passed to the network device.
+				SENT,
+				/// All the data was acknowledged by the peer (TCP only, if requested).
+				ACKNOWLEDGED,
+			};
+			
+			struct Completion
+			{
+				/// The identifier returned by send().
+				std::uint32_t identifier;
+				Stage stage;
+				Nanoseconds time;
+			};
+			
+			/// Enable timestamping on a connected socket. Acknowledgement timestamps are only reported if requested. Stays disabled (see enabled()) on platforms without SO_TIMESTAMPING.
+			Timestamping(Socket & socket, Reactor & reactor, bool acknowledged = false);
+			~Timestamping();
+			
+			Timestamping(const Timestamping &) = delete;
+			Timestamping & operator=(const Timestamping &) = delete;
+			
+			bool enabled() const noexcept {return _enabled;}
+			
+			/// Send all the data, returning an identifier which matches the completions for this send.
+			///
+			/// A stream send which doesn't fit in the socket buffer takes several system calls, and the kernel reports each stage for the last byte of every call. Only the completions for the last byte of the send, which are for all of its data, are kept.
+			std::uint32_t send(const void * data, std::size_t size);
+			
+			/// Receive data as Socket::receive, setting received to the time the kernel received it, or 0 if not known. Send timestamps which arrive while waiting are collected.
+			std::size_t receive(void * data, std::size_t size, Nanoseconds & received);
+			std::size_t receive(void * data, std::size_t size, Nanoseconds & received, const Deadline & deadline);
+			
+			/// Read send timestamps from the error queue, without waiting. On loopback, the scheduled and sent timestamps of a request are available by the time its response has been received. Returns the number of completions read.
+			std::size_t collect();
+			
+			/// Take the oldest completion which has been collected, returning false if there are none.
+			bool pop(Completion & completion);
+			
+			/// Completions which have been collected but not yet taken.
+			std::size_t pending() const noexcept {return _completions.size();}
+			
+		private:
+			std::size_t receive(void * data, std::size_t size, Nanoseconds & received, const Deadline * deadline);
+			
+			// Whether the completion is for the last byte of a send, forgetting sends which can't have any more completions:
+			bool complete(std::uint32_t identifier, Stage stage);
+			
+			Socket & _socket;
+			Reactor & _reactor;
+			
+			bool _enabled = false;
+			bool _stream = false;
+			
+			/// The last stage reported for each send.
+			Stage _final = SENT;
+			
+			/// For stream sockets the kernel identifies each send by the offset of its last byte, while datagrams are numbered.
+			std::uint32_t _offset = 0;
+			
+			/// The identifiers of stream sends which haven't reached the final stage, oldest first.
+			std::deque<std::uint32_t> _sends;
+			
+			std::deque<Completion> _completions;
+		};
+	}
+}
@@ -0,0 +1,56 @@
+//
+//  TransportInfo.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Time/Interval.hpp>
+
+#include <cstdint>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// A snapshot of the kernel's view of a TCP connection, from TCP_INFO. Fields which the running kernel does not report are zero.
+		struct TransportInfo
+		{
+			/// TCP_ESTABLISHED, etc.
+			std::uint8_t state = 0;
+			
+			/// Smoothed round trip time, and its mean deviation.
+			Time::Interval round_trip_time = 0;
+			Time::Interval round_trip_time_variance = 0;
+			Time::Interval minimum_round_trip_time = 0;
+			
+			/// The receiver's estimate of the round trip time, which grows when the application is slow to read.
+			Time::Interval receive_round_trip_time = 0;
+			
+			Time::Interval retransmission_timeout = 0;
+			
+			/// The congestion window and slow start threshold, in segments.
+			std::uint32_t congestion_window = 0;
+			std::uint32_t slow_start_threshold = 0;
+			std::uint32_t maximum_segment_size = 0;
+			
+			/// Segments sent but not yet acknowledged, presumed lost, and being retransmitted.
+			std::uint32_t unacknowledged = 0;
+			std::uint32_t lost = 0;
+			std::uint32_t retransmitting = 0;
+			
+			/// Retransmissions over the lifetime of the connection.
+			std::uint32_t total_retransmits = 0;
+			
+			/// Bytes written by the application but not yet sent.
+			std::uint32_t not_sent = 0;
+			
+			/// The rate at which the kernel is pacing, and the most recent delivery rate, in bytes per second.
+			std::uint64_t pacing_rate = 0;
+			std::uint64_t delivery_rate = 0;
+		};
+	}
+}
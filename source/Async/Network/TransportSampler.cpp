@@ -0,0 +1,117 @@
+//
+//  TransportSampler.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "TransportSampler.hpp"
+
+#include <Async/After.hpp>
+
+#include <system_error>
+
+#include <sys/stat.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		TransportSampler::TransportSampler(Reactor & reactor, Time::Interval period) : _reactor(reactor), _period(period)
+		{
+			_fibers.resume([this]{
+				Concurrent::Fiber::current->annotate("transport sampler");
+				
+				while (true) {
+					After(_period, _reactor).wait();
+					sample();
+				}
+			});
+		}
+		
+		namespace
+		{
+			bool identify(Descriptor descriptor, dev_t & device, ino_t & inode)
+			{
+				struct stat status;
+				
+				if (::fstat(descriptor, &status) == -1) return false;
+				
+				device = status.st_dev;
+				inode = status.st_ino;
+				
+				return true;
+			}
+		}
+		
+		void TransportSampler::add(const Socket & socket)
+		{
+			Connection connection;
+			
+			if (!identify(socket, connection.device, connection.inode))
+				throw std::system_error(errno, std::generic_category(), "fstat");
+			
+			// Retransmits before the connection was added are not counted:
+			connection.total_retransmits = socket.transport_info().total_retransmits;
+			
+			_connections[socket.descriptor()] = connection;
+		}
+		
+		void TransportSampler::remove(const Socket & socket)
+		{
+			_connections.erase(socket.descriptor());
+		}
+		
+		void TransportSampler::record(Descriptor descriptor, Connection & connection)
+		{
+			dev_t device; ino_t inode;
+			
+			// The socket was closed, and the descriptor may now refer to another file:
+			if (!identify(descriptor, device, inode) || device != connection.device || inode != connection.inode)
+				throw std::system_error(EBADF, std::generic_category(), "fstat");
+			
+			auto info = Socket::transport_info(descriptor);
+			
+			_round_trip_time.record(static_cast<std::uint64_t>(info.round_trip_time * 1e6));
+			_round_trip_time_variance.record(static_cast<std::uint64_t>(info.round_trip_time_variance * 1e6));
+			_congestion_window.record(info.congestion_window);
+			_unacknowledged.record(info.unacknowledged);
+			_pacing_rate.record(info.pacing_rate);
+			
+			if (info.total_retransmits >= connection.total_retransmits)
+				_retransmits.record(info.total_retransmits - connection.total_retransmits);
+			
+			connection.total_retransmits = info.total_retransmits;
+		}
+		
+		void TransportSampler::sample()
+		{
+			auto iterator = _connections.begin();
+			
+			while (iterator != _connections.end()) {
+				try {
+					record(iterator->first, iterator->second);
+					++iterator;
+				} catch (std::system_error &) {
+					// The descriptor was closed, or is no longer a TCP socket:
+					iterator = _connections.erase(iterator);
+				}
+			}
+			
+			_samples += 1;
+		}
+		
+		void TransportSampler::clear() noexcept
+		{
+			_samples = 0;
+			
+			_round_trip_time.clear();
+			_round_trip_time_variance.clear();
+			_congestion_window.clear();
+			_retransmits.clear();
+			_unacknowledged.clear();
+			_pacing_rate.clear();
+		}
+	}
+}
@@ -0,0 +1,86 @@
+//
+//  TransportSampler.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Socket.hpp"
+#include "Histogram.hpp"
+
+#include <Concurrent/Fiber.hpp>
+
+#include <map>
+
+#include <sys/stat.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Periodically records the transport metrics of a set of live connections into histograms, so that a rise in latency can be attributed to retransmits, a small congestion window or receiver side queueing. Sampling runs in a fiber on the given reactor; sockets which have been closed are dropped at the next sample, even if their descriptor has been reused.
+		class TransportSampler
+		{
+		public:
+			TransportSampler(Reactor & reactor, Time::Interval period = 1.0);
+			
+			TransportSampler(const TransportSampler &) = delete;
+			TransportSampler & operator=(const TransportSampler &) = delete;
+			
+			/// Start sampling the given connection. The sampler identifies the socket by its descriptor and inode, so a socket which is closed without being removed is never confused with a later one using the same descriptor. Throws std::system_error if the socket is not a TCP connection.
+			void add(const Socket & socket);
+			void remove(const Socket & socket);
+			
+			std::size_t size() const noexcept {return _connections.size();}
+			
+			/// Sample every connection now, in addition to the periodic samples.
+			void sample();
+			
+			std::size_t samples() const noexcept {return _samples;}
+			
+			/// The smoothed round trip time, in microseconds.
+			const Histogram & round_trip_time() const noexcept {return _round_trip_time;}
+			const Histogram & round_trip_time_variance() const noexcept {return _round_trip_time_variance;}
+			
+			/// The congestion window, in segments.
+			const Histogram & congestion_window() const noexcept {return _congestion_window;}
+			
+			/// Retransmissions since the previous sample of the same connection.
+			const Histogram & retransmits() const noexcept {return _retransmits;}
+			
+			/// Segments in flight, not yet acknowledged.
+			const Histogram & unacknowledged() const noexcept {return _unacknowledged;}
+			
+			/// The pacing rate, in bytes per second.
+			const Histogram & pacing_rate() const noexcept {return _pacing_rate;}
+			
+			void clear() noexcept;
+			
+		private:
+			struct Connection
+			{
+				dev_t device;
+				ino_t inode;
+				
+				/// The lifetime retransmit count at the last sample, or when the connection was added.
+				std::uint32_t total_retransmits;
+			};
+			
+			void record(Descriptor descriptor, Connection & connection);
+			
+			Reactor & _reactor;
+			Time::Interval _period;
+			
+			std::map<Descriptor, Connection> _connections;
+			
+			std::size_t _samples = 0;
+			
+			Histogram _round_trip_time, _round_trip_time_variance, _congestion_window, _retransmits, _unacknowledged, _pacing_rate;
+			
+			Concurrent::Fiber::Pool _fibers;
+		};
+	}
+}
@@ -0,0 +1,169 @@
+//
+//  ZeroCopy.cpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ZeroCopy.hpp"
+
+#include <sys/socket.h>
+#include <system_error>
+
+#ifdef __linux__
+#include <netinet/in.h>
+#include <linux/errqueue.h>
+#endif
+
+namespace Async
+{
+	namespace Network
+	{
+		ZeroCopySender::ZeroCopySender(Socket & socket, Reactor & reactor, Release release, std::size_t threshold) : _socket(socket), _reactor(reactor), _release(release), _threshold(threshold)
+		{
+#ifdef MSG_ZEROCOPY
+			_enabled = _socket.set_zero_copy();
+#endif
+		}
+		
+		ZeroCopySender::~ZeroCopySender()
+		{
+		}
+		
+		void ZeroCopySender::release(Buffer && buffer)
+		{
+			if (_release) _release(std::move(buffer));
+		}
+		
+		void ZeroCopySender::write(Buffer && buffer)
+		{
+			int flags = 0;
+			
+#ifdef MSG_NOSIGNAL
+			flags |= MSG_NOSIGNAL;
+#endif
+			
+#ifdef MSG_ZEROCOPY
+			bool zero_copy = _enabled && buffer.size() >= _threshold;
+			if (zero_copy) flags |= MSG_ZEROCOPY;
+#else
+			bool zero_copy = false;
+#endif
+			
+			std::size_t offset = 0;
+			bool used = false;
+			
+			while (offset < buffer.size()) {
+				auto result = ::send(_socket, buffer.data() + offset, buffer.size() - offset, flags);
+				
+				if (result == -1) {
+					if (errno == EAGAIN || errno == EWOULDBLOCK) {
+						Writable event(_socket, _reactor);
+						event.wait();
+					} else if (errno == ENOBUFS && zero_copy) {
+						// Too many outstanding zero-copy sends, wait for some completions, which may be for this buffer. Error queue notifications are reported as readable.
+						if (collect() == 0) {
+							Readable event(_socket, _reactor);
+							event.wait();
+						}
+					} else if (errno != EINTR) {
+						throw std::system_error(errno, std::generic_category(), "send");
+					}
+				} else {
+					offset += result;
+					
+					if (zero_copy) {
+						_next_sequence += 1;
+						used = true;
+					}
+				}
+			}
+			
+			if (used) {
+				_pending.push_back({std::move(buffer), _next_sequence - 1});
+			} else {
+				release(std::move(buffer));
+			}
+			
+			reclaim();
+		}
+		
+		std::size_t ZeroCopySender::collect()
+		{
+			std::size_t count = 0;
+			
+#ifdef MSG_ZEROCOPY
+			if (!_enabled) return 0;
+			
+			char control[128];
+			
+			while (true) {
+				msghdr message = {};
+				message.msg_control = control;
+				message.msg_controllen = sizeof(control);
+				
+				auto result = ::recvmsg(_socket, &message, MSG_ERRQUEUE);
+				
+				if (result == -1) {
+					if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+						break;
+					
+					throw std::system_error(errno, std::generic_category(), "recvmsg(MSG_ERRQUEUE)");
+				}
+				
+				for (auto header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header)) {
+					// Other messages, e.g. SCM_TIMESTAMPING, may share the error queue:
+					if (!(header->cmsg_level == IPPROTO_IP && header->cmsg_type == IP_RECVERR) && !(header->cmsg_level == IPPROTO_IPV6 && header->cmsg_type == IPV6_RECVERR))
+						continue;
+					
+					auto error = reinterpret_cast<sock_extended_err *>(CMSG_DATA(header));
+					
+					if (error->ee_errno != 0 || error->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+						continue;
+					
+					if (error->ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+						_copied += 1;
+					
+					// Notifications cover the inclusive range [ee_info, ee_data], and the subtraction handles wrapping:
+					std::uint32_t next = error->ee_data + 1;
+					
+					if (std::int32_t(next - _completed) > 0)
+						_completed = next;
+					
+					count += 1;
+				}
+			}
+#endif
+			
+			return count;
+		}
+		
+		std::size_t ZeroCopySender::reclaim()
+		{
+			collect();
+			
+			std::size_t released = 0;
+			
+			// Buffers are released in order, once their last send has completed:
+			while (!_pending.empty() && std::int32_t(_completed - _pending.front().sequence) > 0) {
+				release(std::move(_pending.front().buffer));
+				_pending.pop_front();
+				
+				released += 1;
+			}
+			
+			return released;
+		}
+		
+		void ZeroCopySender::flush()
+		{
+			while (!_pending.empty()) {
+				if (reclaim() == 0) {
+					Readable event(_socket, _reactor);
+					event.wait();
+				}
+			}
+		}
+	}
+}
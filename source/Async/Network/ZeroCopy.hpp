@@ -0,0 +1,88 @@
+//
+//  ZeroCopy.hpp
+//  File file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Socket.hpp"
+
+#include <Async/Readable.hpp>
+#include <Async/Writable.hpp>
+
+#include <deque>
+#include <functional>
+#include <cstdint>
+
+namespace Async
+{
+	namespace Network
+	{
+		/// Sends large buffers on a connected stream socket using MSG_ZEROCOPY. The kernel reads directly from the buffer after send returns, so the sender keeps ownership of each buffer until the kernel reports (on the socket error queue) that it has been released, and then hands it back through the release callback. Writes smaller than the threshold, or on platforms without zero-copy support, are copied as usual and released immediately.
+		class ZeroCopySender
+		{
+		public:
+			typedef std::string Buffer;
+			typedef std::function<void(Buffer &&)> Release;
+			
+			ZeroCopySender(Socket & socket, Reactor & reactor, Release release = nullptr, std::size_t threshold = 16*1024);
+			~ZeroCopySender();
+			
+			ZeroCopySender(const ZeroCopySender &) = delete;
+			ZeroCopySender & operator=(const ZeroCopySender &) = delete;
+			
+			/// Whether zero-copy sends are enabled on the socket.
+			bool enabled() const noexcept {return _enabled;}
+			
+			/// Send the entire buffer, waiting for the socket to become writable as required. The buffer is handed back via the release callback once the kernel no longer needs it.
+			void write(Buffer && buffer);
+			
+			/// Process any completion notifications without waiting. Returns the number of buffers released.
+			std::size_t reclaim();
+			
+			/// Wait until every buffer has been released.
+			void flush();
+			
+			/// Buffers which are still owned by the kernel.
+			std::size_t pending() const noexcept {return _pending.size();}
+			
+			/// The number of completions where the kernel fell back to copying, e.g. on loopback.
+			std::size_t copied() const noexcept {return _copied;}
+			
+		private:
+			struct Pending
+			{
+				Buffer buffer;
+				
+				/// The sequence number of the last zero-copy send which used this buffer.
+				std::uint32_t sequence;
+			};
+			
+			void release(Buffer && buffer);
+			
+			/// Read completion notifications from the error queue without waiting, including those for a buffer which is still being written. Returns the number of notifications read.
+			std::size_t collect();
+			
+			Socket & _socket;
+			Reactor & _reactor;
+			
+			Release _release;
+			std::size_t _threshold;
+			
+			bool _enabled = false;
+			
+			/// Each zero-copy send is assigned the next sequence number by the kernel.
+			std::uint32_t _next_sequence = 0;
+			
+			/// Every send with a sequence number before this one has completed.
+			std::uint32_t _completed = 0;
+			
+			std::size_t _copied = 0;
+			
+			std::deque<Pending> _pending;
+		};
+	}
+}
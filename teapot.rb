@@ -57,6 +57,20 @@ define_target "async-nework-tests" do |target|
 	end
 end
 
+define_target "async-network-benchmarks" do |target|
+	target.depends "Language/C++14", private: true
+	
+	target.depends "Library/AsyncNetwork"
+	
+	target.provides "Benchmark/AsyncNetwork" do |*arguments|
+		benchmark_root = target.package.path + 'benchmark'
+		
+		executable_path = build executable: "AsyncNetworkBenchmark", source_files: benchmark_root.glob('Async/Network/**/*.cpp')
+		
+		run executable: executable_path, arguments: arguments
+	end
+end
+
 # Configurations
 
 define_configuration "development" do |configuration|
@@ -0,0 +1,165 @@
+//
+//  Acceptor.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Parallel/Distributor.hpp>
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Acceptor.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+#include <Async/Protocol/Stream.hpp>
+
+#include <Time/Statistics.hpp>
+#include <Time/Timer.hpp>
+
+#include <signal.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		UnitTest::Suite AcceptorTestSuite {
+			"Async::Network::Acceptor",
+			
+			{"it drains pending connections in one batch",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					auto address = server.local_address();
+					std::vector<Socket> clients;
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						Socket client(PF_INET, SOCK_STREAM);
+						::connect(client, address.data(), address.size());
+						
+						clients.push_back(std::move(client));
+					}
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t accepted = 0, waits = 0;
+					
+					fibers.resume([&]{
+						Acceptor acceptor(server, reactor, 64);
+						
+						accepted = acceptor.accept_batch([](Socket &&){});
+						waits = acceptor.waits();
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(accepted) == 10u;
+					examiner.expect(waits) == 0u;
+				}
+			},
+			
+			{"it connects quickly with batched accept",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					std::mutex statistics_mutex;
+					Time::Statistics client_statistics;
+					
+					auto endpoints = Endpoint::service_endpoints(0, SOCK_STREAM);
+					
+					std::vector<Socket> servers;
+					
+					for (auto && endpoint : endpoints) {
+						auto && socket = endpoint.bind();
+						
+						socket.listen();
+						
+						servers.push_back(std::move(socket));
+					}
+					
+					Time::Timer duration;
+					
+					{
+						Parallel::Distributor<std::function<void()>> server(1, 1);
+						
+						for (std::size_t i = 0; i < server.concurrency(); i += 1) {
+							server([&servers](){
+								Reactor reactor;
+								Fiber::Pool bindings;
+								
+								for (auto && socket : servers) {
+									bindings.resume([&]{
+										Fiber::current->annotate("server");
+										
+										Acceptor acceptor(socket, reactor);
+										
+										while (true) {
+											auto && peer = acceptor.accept();
+											Protocol::Stream protocol(peer, reactor);
+											
+											auto message = protocol.read(12);
+											protocol.write(message);
+										}
+									});
+								}
+								
+								reactor.wait(1.0);
+							});
+						}
+						
+						Parallel::Distributor<std::function<void()>> client(1, 2);
+						
+						for (std::size_t i = 0; i < client.concurrency(); i += 1) {
+							client([&servers, &statistics_mutex, &client_statistics](){
+								Time::Statistics statistics;
+								
+								Reactor reactor;
+								Fiber::Pool connections;
+								
+								for (auto && server : servers) {
+									for (std::size_t j = 0; j < 8; j += 1) {
+										connections.resume([&]{
+											Endpoint endpoint(server);
+											Fiber::current->annotate("client connection");
+											
+											while (true) {
+												auto sample = statistics.sample();
+												
+												auto && peer = endpoint.connect(reactor);
+												Protocol::Stream protocol(peer, reactor);
+												
+												protocol.write("Hello World!");
+												auto message = protocol.read(12);
+											}
+										});
+									}
+									
+									break;
+								}
+								
+								reactor.wait(1.0);
+								
+								{
+									std::lock_guard<std::mutex> guard(statistics_mutex);
+									client_statistics += statistics;
+								}
+							});
+						}
+					}
+					
+					examiner << "Amortized samples: " << client_statistics.amortized_samples_per_second(duration.time()) << std::endl;
+					examiner << "Samples per second: " << client_statistics.samples_per_second() << std::endl;
+					examiner << "Minimum duration: " << client_statistics.minimum_duration() << std::endl;
+					examiner << "Maximum duration: " << client_statistics.maximum_duration() << std::endl;
+					examiner.expect(client_statistics.samples_per_second()).to(be > 100);
+				}
+			},
+		};
+	}
+}
@@ -10,12 +10,29 @@
 
 #include <Async/Network/Address.hpp>
 
+#include <Time/Timer.hpp>
+
 #include <arpa/inet.h>
+#include <netdb.h>
+#include <cstring>
+#include <sstream>
 
 namespace Async
 {
 	namespace Network
 	{
+		using namespace UnitTest::Expectations;
+		
+		static Address ipv6_address(const char * host, Port port)
+		{
+			sockaddr_in6 socket_address = {};
+			socket_address.sin6_family = AF_INET6;
+			socket_address.sin6_port = htons(port);
+			inet_pton(AF_INET6, host, &socket_address.sin6_addr);
+			
+			return Address(reinterpret_cast<struct sockaddr *>(&socket_address), sizeof(socket_address));
+		}
+		
 		UnitTest::Suite AddressTestSuite {
 			"Async::Network::Address",
 			
@@ -32,7 +49,134 @@ namespace Async
 					examiner.expect(address.canonical_name()) == "192.168.1.2";
 					examiner.expect(address.port()) == 12345;
 				}
-			}
+			},
+			
+			{"it can format numeric addresses into a buffer",
+				[](UnitTest::Examiner & examiner) {
+					char buffer[Address::numeric_capacity()];
+					
+					auto ipv4 = Address::parse_numeric("192.168.1.2:80");
+					examiner.expect(ipv4.format_numeric(buffer, sizeof(buffer))) == 14u;
+					examiner.expect(std::string(buffer)) == "192.168.1.2:80";
+					
+					auto ipv6 = ipv6_address("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", 65535);
+					auto length = ipv6.format_numeric(buffer, sizeof(buffer));
+					examiner.expect(std::string(buffer, length)) == "[ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff]:65535";
+					
+					// A buffer which is too small is not overrun:
+					examiner.expect(ipv4.format_numeric(buffer, 8)) == 0u;
+					
+					std::stringstream output;
+					output << ipv6_address("::1", 443);
+					examiner.expect(output.str()) == "[::1]:443";
+					
+					// The scope of a link-local address is kept:
+					auto scoped = Address::parse_numeric("[fe80::1%2]:80");
+					length = scoped.format_numeric(buffer, sizeof(buffer));
+					examiner.expect(std::string(buffer, length)) == "[fe80::1%2]:80";
+					examiner.expect(scoped.canonical_name()) == "fe80::1%2";
+				}
+			},
+			
+			{"it can parse numeric addresses",
+				[](UnitTest::Examiner & examiner) {
+					auto ipv4 = Address::parse_numeric("1.2.3.4:80");
+					examiner.expect(ipv4.family()) == AF_INET;
+					examiner.expect(ipv4.port()) == 80;
+					examiner.expect(ipv4.canonical_name()) == "1.2.3.4";
+					
+					auto ipv6 = Address::parse_numeric("[::1]:8080");
+					examiner.expect(ipv6.family()) == AF_INET6;
+					examiner.expect(ipv6.port()) == 8080;
+					examiner.expect(ipv6 == ipv6_address("::1", 8080)) == true;
+					
+					examiner.expect(Address::parse_numeric("::1").port()) == 0;
+					examiner.expect(Address::parse_numeric("[::1]").family()) == AF_INET6;
+					examiner.expect(Address::parse_numeric("10.0.0.1").port()) == 0;
+					
+					auto scoped = Address::parse_numeric("fe80::1%3");
+					examiner.expect(reinterpret_cast<const sockaddr_in6 *>(scoped.data())->sin6_scope_id) == 3u;
+					examiner.expect(scoped == ipv6_address("fe80::1", 0)) == false;
+					
+					Address address;
+					
+					for (auto text : {"", "localhost:80", "1.2.3.4:", "1.2.3.4:65536", "1.2.3.4:8x", "[::1", "[::1]80", "1.2.3.4.5", "1.2.3.4%1", "[fe80::1%]:80", "fe80::1%no-such-interface"}) {
+						examiner.expect(Address::parse_numeric(text, std::strlen(text), address)) == false;
+					}
+				}
+			},
+			
+			{"it formats addresses faster than getnameinfo",
+				[](UnitTest::Examiner & examiner) {
+					const std::size_t count = 100000;
+					auto address = ipv6_address("2001:db8::1", 443);
+					
+					char buffer[Address::numeric_capacity()];
+					std::size_t total = 0;
+					
+					Time::Timer numeric;
+					
+					for (std::size_t i = 0; i < count; i += 1) {
+						total += address.format_numeric(buffer, sizeof(buffer));
+					}
+					
+					auto numeric_duration = numeric.time();
+					
+					char host[NI_MAXHOST], service[NI_MAXSERV];
+					Time::Timer name_info;
+					
+					for (std::size_t i = 0; i < count; i += 1) {
+						getnameinfo(address.data(), address.size(), host, sizeof(host), service, sizeof(service), NI_NUMERICHOST | NI_NUMERICSERV);
+						total += std::strlen(host) + std::strlen(service);
+					}
+					
+					auto name_info_duration = name_info.time();
+					
+					examiner << "format_numeric: " << numeric_duration / count * 1e9 << "ns per address" << std::endl;
+					examiner << "getnameinfo: " << name_info_duration / count * 1e9 << "ns per address" << std::endl;
+					examiner.expect(total).to(be > 0u);
+					examiner.expect(numeric_duration).to(be < name_info_duration);
+				}
+			},
+			
+			{"it parses addresses faster than getaddrinfo",
+				[](UnitTest::Examiner & examiner) {
+					const std::size_t count = 100000;
+					
+					Address address;
+					std::size_t total = 0;
+					
+					Time::Timer numeric;
+					
+					for (std::size_t i = 0; i < count; i += 1) {
+						total += Address::parse_numeric("192.168.1.2:80", 14, address);
+					}
+					
+					auto numeric_duration = numeric.time();
+					
+					addrinfo hints = {};
+					hints.ai_flags = AI_NUMERICHOST | AI_NUMERICSERV;
+					hints.ai_socktype = SOCK_STREAM;
+					
+					Time::Timer address_info;
+					
+					for (std::size_t i = 0; i < count; i += 1) {
+						addrinfo * result = nullptr;
+						
+						if (getaddrinfo("192.168.1.2", "80", &hints, &result) == 0) {
+							total += 1;
+							freeaddrinfo(result);
+						}
+					}
+					
+					auto address_info_duration = address_info.time();
+					
+					examiner << "parse_numeric: " << numeric_duration / count * 1e9 << "ns per address" << std::endl;
+					examiner << "getaddrinfo: " << address_info_duration / count * 1e9 << "ns per address" << std::endl;
+					examiner.expect(total) == 2 * count;
+					examiner.expect(numeric_duration).to(be < address_info_duration);
+				}
+			},
 		};
 	}
 }
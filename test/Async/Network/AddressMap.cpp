@@ -0,0 +1,150 @@
+//
+//  AddressMap.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Async/Network/AddressMap.hpp>
+
+#include <Time/Timer.hpp>
+
+#include <arpa/inet.h>
+#include <map>
+
+namespace Async
+{
+	namespace Network
+	{
+		using namespace UnitTest::Expectations;
+		
+		// A distinct IPv4 peer for each index.
+		static Address peer_address(std::uint32_t index)
+		{
+			sockaddr_in socket_address = {};
+			socket_address.sin_family = AF_INET;
+			socket_address.sin_port = htons(1024 + index % 60000);
+			socket_address.sin_addr.s_addr = htonl(0x0A000000 + index);
+			
+			return Address(reinterpret_cast<struct sockaddr *>(&socket_address), sizeof(socket_address));
+		}
+		
+		UnitTest::Suite AddressMapTestSuite {
+			"Async::Network::AddressMap",
+			
+			{"it converts addresses losslessly",
+				[](UnitTest::Examiner & examiner) {
+					for (auto text : {"192.168.1.2:80", "[2001:db8::1]:443", "[::1]:0"}) {
+						auto address = Address::parse_numeric(text);
+						CompactAddress compact(address);
+						
+						examiner.expect(compact.family()) == address.family();
+						examiner.expect(compact.port()) == address.port();
+						examiner.expect(compact.address() == address) == true;
+					}
+					
+					examiner.expect(CompactAddress(peer_address(1)) == CompactAddress(peer_address(1))) == true;
+					examiner.expect(CompactAddress(peer_address(1)) == CompactAddress(peer_address(2))) == false;
+					examiner.expect(CompactAddress(peer_address(1)).hash()) == std::hash<CompactAddress>()(CompactAddress(peer_address(1)));
+					
+					examiner.expect(CompactAddress::is_compact(Address())) == false;
+				}
+			},
+			
+			{"it can insert, find and erase entries",
+				[](UnitTest::Examiner & examiner) {
+					AddressMap<std::size_t> map;
+					const std::uint32_t count = 10000;
+					
+					for (std::uint32_t i = 0; i < count; i += 1) {
+						map[CompactAddress(peer_address(i))] = i;
+					}
+					
+					examiner.expect(map.size()) == count;
+					
+					std::size_t found = 0;
+					
+					for (std::uint32_t i = 0; i < count; i += 1) {
+						auto value = map.find(CompactAddress(peer_address(i)));
+						
+						if (value && *value == i) found += 1;
+					}
+					
+					examiner.expect(found) == count;
+					
+					// Erase every other entry, which exercises shifting entries back into the holes:
+					for (std::uint32_t i = 0; i < count; i += 2) {
+						map.erase(CompactAddress(peer_address(i)));
+					}
+					
+					examiner.expect(map.size()) == count / 2;
+					
+					found = 0;
+					
+					for (std::uint32_t i = 0; i < count; i += 1) {
+						auto value = map.find(CompactAddress(peer_address(i)));
+						
+						if ((i % 2 == 0) == (value == nullptr)) found += 1;
+					}
+					
+					examiner.expect(found) == count;
+					
+					auto inserted = map.insert(CompactAddress(peer_address(1)), 0);
+					examiner.expect(inserted.second) == false;
+				}
+			},
+			
+			{"it is smaller and faster than an ordered map",
+				[](UnitTest::Examiner & examiner) {
+					const std::uint32_t count = 1000000;
+					
+					std::vector<Address> addresses;
+					addresses.reserve(count);
+					
+					for (std::uint32_t i = 0; i < count; i += 1) {
+						addresses.push_back(peer_address(i * 2654435761u));
+					}
+					
+					std::map<Address, std::uint32_t> ordered;
+					AddressMap<std::uint32_t> flat(count);
+					
+					for (std::uint32_t i = 0; i < count; i += 1) {
+						ordered[addresses[i]] = i;
+						flat[CompactAddress(addresses[i])] = i;
+					}
+					
+					std::size_t total = 0;
+					
+					Time::Timer ordered_timer;
+					
+					for (auto & address : addresses) {
+						total += ordered.find(address)->second;
+					}
+					
+					auto ordered_duration = ordered_timer.time();
+					
+					Time::Timer flat_timer;
+					
+					for (auto & address : addresses) {
+						total -= *flat.find(CompactAddress(address));
+					}
+					
+					auto flat_duration = flat_timer.time();
+					
+					// Each node of a red-black tree also has three pointers and a colour:
+					auto ordered_memory = count * (sizeof(std::map<Address, std::uint32_t>::value_type) + 4 * sizeof(void *));
+					
+					examiner << "std::map: " << ordered_duration / count * 1e9 << "ns per lookup, approximately " << ordered_memory / (1024 * 1024) << "MB" << std::endl;
+					examiner << "AddressMap: " << flat_duration / count * 1e9 << "ns per lookup, " << flat.memory() / (1024 * 1024) << "MB" << std::endl;
+					
+					examiner.expect(total) == 0u;
+					examiner.expect(flat.memory()).to(be < ordered_memory);
+					examiner.expect(flat_duration).to(be < ordered_duration);
+				}
+			},
+		};
+	}
+}
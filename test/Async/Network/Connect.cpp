@@ -0,0 +1,145 @@
+//
+//  Connect.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Connect.hpp>
+#include <Async/Reactor.hpp>
+
+#include <sys/socket.h>
+#include <netinet/tcp.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// A listener whose backlog is full, so that further connection attempts are never answered.
+		static Socket bind_unresponsive_listener(std::vector<Socket> & backlog)
+		{
+			auto socket = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+			socket.listen(0);
+			
+			auto address = socket.local_address();
+			
+			for (std::size_t i = 0; i < 4; i += 1) {
+				Socket client(PF_INET, SOCK_STREAM);
+				::connect(client, address.data(), address.size());
+				
+				backlog.push_back(std::move(client));
+			}
+			
+			return socket;
+		}
+		
+		UnitTest::Suite ConnectTestSuite {
+			"Async::Network::Connect",
+			
+			{"it interleaves address families",
+				[](UnitTest::Examiner & examiner) {
+					auto ipv4 = Endpoint::named_endpoints("127.0.0.1", 80).front();
+					auto ipv6 = Endpoint::named_endpoints("::1", 80).front();
+					
+					auto endpoints = interleave_families({ipv6, ipv6, ipv6, ipv4, ipv4});
+					
+					examiner.expect(endpoints.size()) == 5u;
+					examiner.expect(endpoints[0].address().family()) == AF_INET6;
+					examiner.expect(endpoints[1].address().family()) == AF_INET;
+					examiner.expect(endpoints[2].address().family()) == AF_INET6;
+					examiner.expect(endpoints[3].address().family()) == AF_INET;
+					examiner.expect(endpoints[4].address().family()) == AF_INET6;
+				}
+			},
+			
+			{"it connects to the first responsive endpoint",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<Socket> backlog;
+					auto unresponsive = bind_unresponsive_listener(backlog);
+					
+					auto responsive = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					responsive.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t attempts = 0;
+					Time::Interval duration = 0;
+					bool connected = false;
+					
+					fibers.resume([&]{
+						auto connection = connect_any({Endpoint(unresponsive), Endpoint(responsive)}, reactor, 0.05);
+						
+						connected = connection.endpoint.address() == responsive.local_address();
+						attempts = connection.attempts;
+						duration = connection.duration;
+					});
+					
+					reactor.wait(1.0);
+					
+					examiner << "Connected after " << duration << std::endl;
+					examiner.expect(connected) == true;
+					examiner.expect(attempts) == 2u;
+					examiner.expect(duration).to(be < Time::Interval(1.0));
+				}
+			},
+			
+			{"it applies the endpoint's options",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Endpoint endpoint(server);
+					endpoint.set_options(SocketOptions().no_delay());
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					int no_delay = 0;
+					
+					fibers.resume([&]{
+						auto connection = connect_any({endpoint}, reactor);
+						
+						socklen_t size = sizeof(no_delay);
+						::getsockopt(connection.socket, IPPROTO_TCP, TCP_NODELAY, &no_delay, &size);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(no_delay != 0) == true;
+				}
+			},
+			
+			{"it fails when no endpoint can be connected",
+				[](UnitTest::Examiner & examiner) {
+					// Bind and close a socket to find a port with nothing listening on it:
+					auto endpoint = Endpoint(Endpoint::named_endpoints("127.0.0.1", 0).front().bind());
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					bool failed = false;
+					
+					fibers.resume([&]{
+						try {
+							connect_any({endpoint, endpoint}, reactor, 0.05);
+						} catch (std::system_error & error) {
+							failed = true;
+						}
+					});
+					
+					reactor.wait(0.5);
+					
+					examiner.expect(failed) == true;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,312 @@
+//
+//  ConnectionPool.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/ConnectionPool.hpp>
+#include <Async/Network/Acceptor.hpp>
+#include <Async/Reactor.hpp>
+#include <Async/After.hpp>
+#include <Async/Protocol/Stream.hpp>
+
+#include <Time/Statistics.hpp>
+
+#include <memory>
+
+#include <signal.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// Echo 12 byte messages on each connection until the client closes it.
+		static void echo_server(Fiber::Pool & fibers, const Socket & server, Reactor & reactor)
+		{
+			fibers.resume([&]{
+				Acceptor acceptor(server, reactor);
+				
+				while (true) {
+					auto peer = std::make_shared<Socket>(acceptor.accept());
+					
+					fibers.resume([peer, &reactor]{
+						Protocol::Stream protocol(*peer, reactor);
+						
+						while (true) {
+							auto message = protocol.read(12);
+							if (message.size() < 12) break;
+							
+							protocol.write(message);
+						}
+					});
+				}
+			});
+		}
+		
+		static Time::Statistics measure(const Endpoint & endpoint, Reactor & reactor, ConnectionPool * pool)
+		{
+			Time::Statistics statistics;
+			Fiber::Pool clients;
+			
+			for (std::size_t i = 0; i < 8; i += 1) {
+				clients.resume([&]{
+					while (true) {
+						auto sample = statistics.sample();
+						
+						if (pool) {
+							auto lease = pool->acquire(endpoint);
+							Protocol::Stream protocol(lease, reactor);
+							
+							protocol.write("Hello World!");
+							protocol.read(12);
+							
+							lease.release();
+						} else {
+							auto peer = endpoint.connect(reactor);
+							Protocol::Stream protocol(peer, reactor);
+							
+							protocol.write("Hello World!");
+							protocol.read(12);
+						}
+					}
+				});
+			}
+			
+			reactor.wait(1.0);
+			
+			return statistics;
+		}
+		
+		UnitTest::Suite ConnectionPoolTestSuite {
+			"Async::Network::ConnectionPool",
+			
+			{"it reuses released connections",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					ConnectionPool pool(reactor);
+					
+					echo_server(fibers, server, reactor);
+					
+					bool first_reused = true, second_reused = false;
+					
+					fibers.resume([&]{
+						Endpoint endpoint(server);
+						
+						{
+							auto lease = pool.acquire(endpoint);
+							first_reused = lease.reused();
+							lease.release();
+						}
+						
+						{
+							auto lease = pool.acquire(endpoint);
+							second_reused = lease.reused();
+						}
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(first_reused) == false;
+					examiner.expect(second_reused) == true;
+					examiner.expect(pool.statistics().connected) == 1u;
+					
+					// The second lease was not released, so it was closed:
+					examiner.expect(pool.idle()) == 0u;
+				}
+			},
+			
+			{"it discards connections closed by the peer",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					ConnectionPool pool(reactor);
+					
+					std::size_t connected = 0;
+					
+					fibers.resume([&]{
+						Acceptor acceptor(server, reactor);
+						
+						// Accept the connection and close it immediately:
+						acceptor.accept();
+					});
+					
+					fibers.resume([&]{
+						Endpoint endpoint(server);
+						
+						pool.acquire(endpoint).release();
+						
+						After(0.05, reactor).wait();
+						
+						auto lease = pool.acquire(endpoint);
+						connected = pool.statistics().connected;
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(connected) == 2u;
+					examiner.expect(pool.statistics().reused) == 0u;
+				}
+			},
+			
+			{"it waits when the maximum number of connections are active",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					ConnectionPool::Options options;
+					options.maximum_active = 1;
+					ConnectionPool pool(reactor, options);
+					
+					echo_server(fibers, server, reactor);
+					
+					std::size_t completed = 0;
+					
+					for (std::size_t i = 0; i < 4; i += 1) {
+						fibers.resume([&]{
+							auto lease = pool.acquire(Endpoint(server));
+							Protocol::Stream protocol(lease, reactor);
+							
+							protocol.write("Hello World!");
+							protocol.read(12);
+							
+							lease.release();
+							completed += 1;
+						});
+					}
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(completed) == 4u;
+					examiner.expect(pool.statistics().connected) == 1u;
+					examiner.expect(pool.statistics().waits).to(be > 0u);
+				}
+			},
+			
+			{"it evicts idle connections",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					ConnectionPool::Options options;
+					options.idle_timeout = 0.01;
+					ConnectionPool pool(reactor, options);
+					
+					echo_server(fibers, server, reactor);
+					
+					fibers.resume([&]{
+						pool.acquire(Endpoint(server)).release();
+					});
+					
+					reactor.wait(0.05);
+					
+					examiner.expect(pool.idle()) == 1u;
+					examiner.expect(pool.evict()) == 1u;
+					examiner.expect(pool.idle()) == 0u;
+				}
+			},
+			
+			{"it counts failed connections separately",
+				[](UnitTest::Examiner & examiner) {
+					// Bind and close a socket to find a port with nothing listening on it:
+					auto endpoint = Endpoint(Endpoint::named_endpoints("127.0.0.1", 0).front().bind());
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					ConnectionPool pool(reactor);
+					
+					bool failed = false;
+					
+					fibers.resume([&]{
+						try {
+							pool.acquire(endpoint);
+						} catch (std::system_error &) {
+							failed = true;
+						}
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(failed) == true;
+					examiner.expect(pool.statistics().failed) == 1u;
+					examiner.expect(pool.statistics().discarded) == 0u;
+				}
+			},
+			
+			{"it closes leases which outlive their pool",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					echo_server(fibers, server, reactor);
+					
+					bool closed = false;
+					
+					fibers.resume([&]{
+						std::unique_ptr<ConnectionPool> pool(new ConnectionPool(reactor));
+						
+						auto lease = pool->acquire(Endpoint(server));
+						pool.reset();
+						
+						lease.release();
+						closed = lease.socket().descriptor() == -1;
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(closed) == true;
+				}
+			},
+			
+			{"it is faster than connecting for each request",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Endpoint endpoint(server);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					echo_server(fibers, server, reactor);
+					
+					auto unpooled = measure(endpoint, reactor, nullptr);
+					
+					ConnectionPool pool(reactor);
+					auto pooled = measure(endpoint, reactor, &pool);
+					
+					examiner << "Unpooled requests per second: " << unpooled.samples_per_second() << std::endl;
+					examiner << "Pooled requests per second: " << pooled.samples_per_second() << std::endl;
+					examiner << "Connections: " << pool.statistics().connected << ", reused: " << pool.statistics().reused << std::endl;
+					
+					examiner.expect(pooled.samples_per_second()).to(be > unpooled.samples_per_second());
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,342 @@
+//
+//  Datagrams.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Datagrams.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		static Socket bind_loopback_datagram()
+		{
+			return Endpoint::named_endpoints("127.0.0.1", 0, SOCK_DGRAM).front().bind();
+		}
+		
+		// Returns the number of packets received per second.
+		static double packets_per_second(bool batched)
+		{
+			const std::size_t batch_size = 64, message_size = 64;
+			
+			auto receiver = bind_loopback_datagram();
+			auto sender = bind_loopback_datagram();
+			auto address = receiver.local_address();
+			
+			Reactor reactor;
+			Fiber::Pool fibers;
+			
+			std::size_t received = 0;
+			char message[message_size] = {0};
+			
+			fibers.resume([&]{
+				if (batched) {
+					Datagrams datagrams(batch_size, message_size);
+					
+					while (true) received += datagrams.receive(receiver, reactor);
+				} else {
+					Address peer;
+					
+					while (true) {
+						receiver.receive_from(message, sizeof(message), peer, reactor);
+						received += 1;
+					}
+				}
+			});
+			
+			fibers.resume([&]{
+				if (batched) {
+					Datagrams datagrams(batch_size, message_size);
+					
+					while (true) {
+						while (!datagrams.full()) datagrams.push_back(message, sizeof(message), address);
+						
+						datagrams.send(sender, reactor);
+					}
+				} else {
+					while (true) sender.send_to(message, sizeof(message), address, reactor);
+				}
+			});
+			
+			reactor.wait(1.0);
+			
+			return received;
+		}
+		
+		// Returns the number of bytes received per second.
+		static double segment_throughput(bool offload)
+		{
+			const std::size_t segment_size = 1200, segments = 64;
+			
+			auto receiver = bind_loopback_datagram();
+			auto sender = bind_loopback_datagram();
+			auto address = receiver.local_address();
+			
+			if (offload) receiver.set_receive_offload();
+			
+			Reactor reactor;
+			Fiber::Pool fibers;
+			
+			std::size_t received = 0;
+			
+			fibers.resume([&]{
+				std::vector<char> buffer(segment_size * segments);
+				Address peer;
+				
+				while (true) {
+					receiver.receive_segments(buffer.data(), buffer.size(), peer, [&](const char *, std::size_t size){
+						received += size;
+					}, reactor);
+				}
+			});
+			
+			fibers.resume([&]{
+				std::vector<char> buffer(segment_size * segments, 'x');
+				
+				while (true) {
+					if (offload) {
+						sender.send_segments(buffer.data(), buffer.size(), segment_size, address, reactor);
+					} else {
+						for (std::size_t i = 0; i < segments; i += 1)
+							sender.send_to(buffer.data() + i * segment_size, segment_size, address, reactor);
+					}
+				}
+			});
+			
+			reactor.wait(1.0);
+			
+			return received;
+		}
+		
+		UnitTest::Suite DatagramsTestSuite {
+			"Async::Network::Datagrams",
+			
+			{"it can send and receive a batch of datagrams",
+				[](UnitTest::Examiner & examiner) {
+					auto receiver = bind_loopback_datagram();
+					auto sender = bind_loopback_datagram();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t count = 0;
+					Address peer;
+					std::string first;
+					
+					fibers.resume([&]{
+						Datagrams datagrams(16);
+						
+						count = datagrams.receive(receiver, reactor);
+						peer = datagrams.address(0);
+						first.assign(datagrams.data(0), datagrams.length(0));
+					});
+					
+					fibers.resume([&]{
+						Datagrams datagrams(16);
+						
+						for (std::size_t i = 0; i < 10; i += 1) {
+							datagrams.push_back("Hello World!", 12, receiver.local_address());
+						}
+						
+						datagrams.send(sender, reactor);
+						examiner.expect(datagrams.empty()) == true;
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(count) == 10u;
+					examiner.expect(first) == "Hello World!";
+					examiner.expect(peer) == sender.local_address();
+				}
+			},
+			
+			{"it reports truncated datagrams",
+				[](UnitTest::Examiner & examiner) {
+					auto receiver = bind_loopback_datagram();
+					auto sender = bind_loopback_datagram();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t count = 0;
+					std::vector<bool> truncated;
+					
+					fibers.resume([&]{
+						Datagrams datagrams(16, 8);
+						
+						count = datagrams.receive(receiver, reactor);
+						
+						for (std::size_t i = 0; i < count; i += 1)
+							truncated.push_back(datagrams.truncated(i));
+					});
+					
+					fibers.resume([&]{
+						sender.send_to("Hello", 5, receiver.local_address(), reactor);
+						sender.send_to("Hello World!", 12, receiver.local_address(), reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(count) == 2u;
+					examiner.expect(truncated[0]) == false;
+					examiner.expect(truncated[1]) == true;
+				}
+			},
+			
+			{"it sends and receives packets quickly",
+				[](UnitTest::Examiner & examiner) {
+					auto single = packets_per_second(false);
+					auto batched = packets_per_second(true);
+					
+					examiner << "sendto/recvfrom: " << single << " packets per second." << std::endl;
+					examiner << "sendmmsg/recvmmsg: " << batched << " packets per second." << std::endl;
+					
+					examiner.expect(batched).to(be > 1000);
+				}
+			},
+			
+			{"it can split coalesced datagrams",
+				[](UnitTest::Examiner & examiner) {
+					auto receiver = bind_loopback_datagram();
+					auto sender = bind_loopback_datagram();
+					
+					receiver.set_receive_offload();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::vector<std::size_t> sizes;
+					
+					fibers.resume([&]{
+						char buffer[65536];
+						Address peer;
+						
+						while (sizes.size() < 4) {
+							receiver.receive_segments(buffer, sizeof(buffer), peer, [&](const char *, std::size_t size){
+								sizes.push_back(size);
+							}, reactor);
+						}
+					});
+					
+					fibers.resume([&]{
+						std::string data(3500, 'x');
+						
+						sender.send_segments(data.data(), data.size(), 1000, receiver.local_address(), reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(sizes.size()) == 4u;
+					examiner.expect(sizes.back()) == 500u;
+				}
+			},
+			
+			{"it fails rather than splitting a truncated batch",
+				[](UnitTest::Examiner & examiner) {
+					auto receiver = bind_loopback_datagram();
+					auto sender = bind_loopback_datagram();
+					
+					auto offload = receiver.set_receive_offload();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t received = 0;
+					bool failed = false;
+					
+					fibers.resume([&]{
+						// Smaller than the coalesced datagram:
+						char buffer[2500];
+						Address peer;
+						
+						try {
+							receiver.receive_segments(buffer, sizeof(buffer), peer, [&](const char *, std::size_t){
+								received += 1;
+							}, reactor);
+						} catch (std::system_error & error) {
+							failed = error.code().value() == EMSGSIZE;
+						}
+					});
+					
+					fibers.resume([&]{
+						std::string data(3500, 'x');
+						
+						sender.send_segments(data.data(), data.size(), 1000, receiver.local_address(), reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					if (offload) {
+						examiner.expect(failed) == true;
+						examiner.expect(received) == 0u;
+					} else {
+						// Each datagram arrives separately, and fits:
+						examiner.expect(received) == 1u;
+					}
+				}
+			},
+			
+			{"it limits each send to the largest UDP payload",
+				[](UnitTest::Examiner & examiner) {
+					auto receiver = bind_loopback_datagram();
+					auto sender = bind_loopback_datagram();
+					
+					receiver.set_receive_offload();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					// 64 segments of 1200 bytes would be larger than 65507 bytes:
+					const std::size_t segment_size = 1200, segments = 100;
+					std::size_t received = 0, bytes = 0;
+					
+					fibers.resume([&]{
+						char buffer[65536];
+						Address peer;
+						
+						while (received < segments) {
+							receiver.receive_segments(buffer, sizeof(buffer), peer, [&](const char *, std::size_t size){
+								received += 1;
+								bytes += size;
+							}, reactor);
+						}
+					});
+					
+					fibers.resume([&]{
+						std::vector<char> data(segment_size * segments, 'x');
+						
+						sender.send_segments(data.data(), data.size(), segment_size, receiver.local_address(), reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(received) == segments;
+					examiner.expect(bytes) == segment_size * segments;
+				}
+			},
+			
+			{"it sends segments quickly with offload",
+				[](UnitTest::Examiner & examiner) {
+					auto plain = segment_throughput(false);
+					auto offload = segment_throughput(true);
+					
+					examiner << "sendto: " << plain / (1024*1024) << " MB per second." << std::endl;
+					examiner << "UDP_SEGMENT/UDP_GRO: " << offload / (1024*1024) << " MB per second." << std::endl;
+					
+					examiner.expect(offload).to(be > 0);
+				}
+			},
+		};
+	}
+}
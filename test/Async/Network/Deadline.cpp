@@ -0,0 +1,190 @@
+//
+//  Deadline.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Deadline.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+#include <Async/Readable.hpp>
+
+#include <Time/Timer.hpp>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		static bool timed_out(const std::system_error & error)
+		{
+			return error.code().value() == ETIMEDOUT;
+		}
+		
+		UnitTest::Suite DeadlineTestSuite {
+			"Async::Network::Deadline",
+			
+			{"it reports the time remaining",
+				[](UnitTest::Examiner & examiner) {
+					Deadline deadline(10);
+					
+					examiner.expect(deadline.expired()) == false;
+					examiner.expect(deadline.remaining()).to(be > Time::Interval(9));
+					
+					Deadline expired(0);
+					examiner.expect(expired.expired()) == true;
+				}
+			},
+			
+			{"it times out connecting to an unresponsive listener",
+				[](UnitTest::Examiner & examiner) {
+					// Fill the backlog so that further connection attempts are never answered:
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen(0);
+					
+					auto address = server.local_address();
+					std::vector<Socket> backlog;
+					
+					for (std::size_t i = 0; i < 4; i += 1) {
+						Socket client(PF_INET, SOCK_STREAM);
+						::connect(client, address.data(), address.size());
+						
+						backlog.push_back(std::move(client));
+					}
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					bool failed = false;
+					Time::Interval duration = 0;
+					
+					fibers.resume([&]{
+						Time::Timer timer;
+						
+						try {
+							Endpoint(server).connect(reactor, Deadline(0.05));
+						} catch (std::system_error & error) {
+							failed = timed_out(error);
+						}
+						
+						duration = timer.time();
+					});
+					
+					reactor.wait(0.5);
+					
+					examiner << "Timed out after " << duration << std::endl;
+					examiner.expect(failed) == true;
+					examiner.expect(duration).to(be < Time::Interval(0.5));
+				}
+			},
+			
+			{"it times out accepting when no client connects",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					bool failed = false, finished = false;
+					
+					fibers.resume([&]{
+						try {
+							server.accept(reactor, Deadline(0.05));
+						} catch (std::system_error & error) {
+							failed = timed_out(error);
+						}
+						
+						finished = true;
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(finished) == true;
+					examiner.expect(failed) == true;
+				}
+			},
+			
+			{"it bounds a whole request with one deadline",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t received = 0;
+					bool failed = false;
+					
+					// The server accepts and reads the request, but never responds:
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						char buffer[12];
+						peer.receive(buffer, sizeof(buffer), reactor);
+						
+						Readable(peer, reactor).wait();
+					});
+					
+					fibers.resume([&]{
+						Deadline deadline(0.05);
+						
+						auto socket = Endpoint(server).connect(reactor, deadline);
+						socket.send("Hello World!", 12, reactor, deadline);
+						
+						char buffer[12];
+						
+						try {
+							received = socket.receive(buffer, sizeof(buffer), reactor, deadline);
+						} catch (std::system_error & error) {
+							failed = timed_out(error);
+						}
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(received) == 0u;
+					examiner.expect(failed) == true;
+				}
+			},
+			
+			{"it completes operations before the deadline",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::string message;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor, Deadline(1.0));
+						
+						char buffer[12];
+						auto size = peer.receive(buffer, sizeof(buffer), reactor, Deadline(1.0));
+						
+						message.assign(buffer, size);
+					});
+					
+					fibers.resume([&]{
+						auto socket = Endpoint(server).connect(reactor, Deadline(1.0));
+						
+						socket.send("Hello World!", 12, reactor, Deadline(1.0));
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(message) == "Hello World!";
+				}
+			},
+		};
+	}
+}
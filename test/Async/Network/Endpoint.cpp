@@ -62,6 +62,27 @@ namespace Async
 					examiner.expect(endpoint.address().port()) == 80;
 				}
 			},
+			
+			{"it resolves numeric hosts the same as getaddrinfo",
+				[](UnitTest::Examiner & examiner) {
+					for (auto host : {"127.0.0.1", "::1"}) {
+						auto endpoints = Endpoint::named_endpoints(host, 8080, SOCK_STREAM);
+						examiner.expect(endpoints.size()) == 1u;
+						
+						addrinfo hints = {}, * result = nullptr;
+						hints.ai_socktype = SOCK_STREAM;
+						
+						examiner.expect(getaddrinfo(host, "8080", &hints, &result)) == 0;
+						
+						auto & endpoint = endpoints.front();
+						examiner.expect(endpoint.address() == Address(result->ai_addr, result->ai_addrlen)) == true;
+						examiner.expect(endpoint.socket_domain()) == result->ai_family;
+						examiner.expect(endpoint.socket_protocol()) == result->ai_protocol;
+						
+						freeaddrinfo(result);
+					}
+				}
+			},
 		};
 	}
 }
@@ -0,0 +1,150 @@
+//
+//  EndpointCache.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Async/Network/EndpointCache.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace Async
+{
+	namespace Network
+	{
+		using namespace UnitTest::Expectations;
+		
+		UnitTest::Suite EndpointCacheTestSuite {
+			"Async::Network::EndpointCache",
+			
+			{"it caches resolved endpoints",
+				[](UnitTest::Examiner & examiner) {
+					std::size_t lookups = 0;
+					
+					EndpointCache cache([&](const std::string &, const Service & service, Socket::Type socket_type, EndpointCache::TTL * ttl){
+						lookups += 1;
+						*ttl = 60;
+						
+						return Endpoint::named_endpoints("127.0.0.1", service, socket_type);
+					});
+					
+					auto endpoints = cache.named_endpoints("service.test", 80);
+					examiner.expect(endpoints.size()) == 1u;
+					
+					for (std::size_t i = 0; i < 100; i += 1) {
+						cache.named_endpoints("service.test", 80);
+					}
+					
+					examiner.expect(lookups) == 1u;
+					examiner.expect(cache.statistics().misses) == 1u;
+					examiner.expect(cache.statistics().hits) == 100u;
+					
+					// A different socket type is a different entry:
+					cache.named_endpoints("service.test", 80, SOCK_DGRAM);
+					examiner.expect(lookups) == 2u;
+					examiner.expect(cache.size()) == 2u;
+				}
+			},
+			
+			{"it caches names which don't exist",
+				[](UnitTest::Examiner & examiner) {
+					std::size_t lookups = 0;
+					
+					EndpointCache cache([&](const std::string &, const Service &, Socket::Type, EndpointCache::TTL *) -> Endpoints {
+						lookups += 1;
+						
+						throw std::system_error(EAI_NONAME, std::generic_category(), gai_strerror(EAI_NONAME));
+					});
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						examiner.expect([&](){
+							cache.named_endpoints("missing.test", 80);
+						}).to(throw_exception<std::system_error>());
+					}
+					
+					examiner.expect(lookups) == 1u;
+					examiner.expect(cache.statistics().negative_hits) == 9u;
+				}
+			},
+			
+			{"it serves stale entries while refreshing",
+				[](UnitTest::Examiner & examiner) {
+					std::size_t lookups = 0;
+					
+					EndpointCache::Options options;
+					options.minimum_ttl = 0;
+					options.stale_ttl = 60;
+					
+					EndpointCache cache([&](const std::string &, const Service & service, Socket::Type socket_type, EndpointCache::TTL * ttl){
+						lookups += 1;
+						*ttl = 0;
+						
+						return Endpoint::named_endpoints("127.0.0.1", service, socket_type);
+					}, options);
+					
+					Concurrent::Fiber::Pool refresh;
+					
+					cache.named_endpoints("service.test", 80);
+					
+					auto endpoints = cache.named_endpoints("service.test", 80, SOCK_STREAM, &refresh);
+					
+					examiner.expect(endpoints.size()) == 1u;
+					examiner.expect(cache.statistics().stale_hits) == 1u;
+					examiner.expect(lookups) == 2u;
+				}
+			},
+			
+			{"it can save and load entries",
+				[](UnitTest::Examiner & examiner) {
+					const std::string path = "endpoint-cache-test.txt";
+					
+					EndpointCache cache;
+					cache.insert("service.test", 80, SOCK_STREAM, Endpoint::named_endpoints("127.0.0.1", 80), 60);
+					cache.save(path);
+					
+					EndpointCache warm([&](const std::string &, const Service &, Socket::Type, EndpointCache::TTL *) -> Endpoints {
+						throw std::logic_error("Entry should have been loaded!");
+					});
+					
+					examiner.expect(warm.load(path)) == 1u;
+					
+					auto endpoints = warm.named_endpoints("service.test", 80);
+					examiner.expect(endpoints.size()) == 1u;
+					examiner.expect(endpoints.front().address().port()) == 80;
+					examiner.expect(endpoints.front().address().canonical_name()) == "127.0.0.1";
+					
+					std::remove(path.c_str());
+				}
+			},
+			
+			{"it skips expired and malformed entries when loading",
+				[](UnitTest::Examiner & examiner) {
+					const std::string path = "endpoint-cache-test.txt";
+					auto now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+					
+					{
+						std::ofstream output(path);
+						
+						// Expired an hour ago, a malformed address, and a live entry:
+						output << "expired.test 80 1 " << now - 3600 << " 2 1 6 020000507f0000010000000000000000\n";
+						output << "malformed.test 80 1 " << now + 60 << " 2 1 6 02zz\n";
+						output << "live.test 80 1 " << now + 60 << " 2 1 6 020000507f0000010000000000000000\n";
+					}
+					
+					EndpointCache cache;
+					
+					examiner.expect(cache.load(path)) == 1u;
+					examiner.expect(cache.size()) == 1u;
+					
+					std::remove(path.c_str());
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,166 @@
+//
+//  FastOpen.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Acceptor.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+
+#include <Time/Statistics.hpp>
+
+#include <fstream>
+#include <memory>
+#include <signal.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// Fast open must be enabled for clients (1) and servers (2) by net.ipv4.tcp_fastopen.
+		static int fast_open_mode()
+		{
+			int mode = 0;
+			std::ifstream("/proc/sys/net/ipv4/tcp_fastopen") >> mode;
+			
+			return mode;
+		}
+		
+		static Socket bind_fast_open_listener()
+		{
+			auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind(SocketOptions().reuse_address().fast_open());
+			server.listen();
+			
+			return server;
+		}
+		
+		// Respond to each 12 byte request and close the connection.
+		static void respond(Fiber::Pool & fibers, const Socket & server, Reactor & reactor)
+		{
+			fibers.resume([&]{
+				Acceptor acceptor(server, reactor);
+				
+				while (true) {
+					auto peer = std::make_shared<Socket>(acceptor.accept());
+					
+					fibers.resume([peer, &reactor]{
+						char buffer[12];
+						std::size_t size = 0;
+						
+						while (size < sizeof(buffer)) {
+							auto result = peer->receive(buffer + size, sizeof(buffer) - size, reactor);
+							if (result == 0) return;
+							
+							size += result;
+						}
+						
+						peer->send(buffer, size, reactor);
+					});
+				}
+			});
+		}
+		
+		static Time::Statistics measure(const Endpoint & endpoint, Reactor & reactor, bool fast_open, std::size_t & carried)
+		{
+			Time::Statistics statistics;
+			Fiber::Pool clients;
+			
+			clients.resume([&]{
+				char buffer[12];
+				
+				while (true) {
+					auto sample = statistics.sample();
+					Socket socket;
+					
+					if (fast_open) {
+						socket = Socket(endpoint.socket_domain(), endpoint.socket_type());
+						carried += socket.connect(endpoint.address(), "Hello World!", 12, reactor);
+					} else {
+						socket = endpoint.connect(reactor);
+						socket.send("Hello World!", 12, reactor);
+					}
+					
+					socket.receive(buffer, sizeof(buffer), reactor);
+				}
+			});
+			
+			reactor.wait(1.0);
+			
+			return statistics;
+		}
+		
+		UnitTest::Suite FastOpenTestSuite {
+			"Async::Network::FastOpen",
+			
+			{"it sends data while connecting",
+				[](UnitTest::Examiner & examiner) {
+					auto server = bind_fast_open_listener();
+					Endpoint endpoint(server);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					respond(fibers, server, reactor);
+					
+					std::string response;
+					
+					fibers.resume([&]{
+						// The first connection requests a cookie, and the second can use it:
+						for (std::size_t i = 0; i < 2; i += 1) {
+							auto socket = endpoint.connect(reactor, "Hello World!", 12);
+							
+							char buffer[12];
+							auto size = socket.receive(buffer, sizeof(buffer), reactor);
+							
+							response.assign(buffer, size);
+						}
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner << "net.ipv4.tcp_fastopen = " << fast_open_mode() << std::endl;
+					examiner.expect(response) == "Hello World!";
+				}
+			},
+			
+			{"it saves a round trip on each connection",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					auto server = bind_fast_open_listener();
+					Endpoint endpoint(server);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					respond(fibers, server, reactor);
+					
+					std::size_t carried = 0, unused = 0;
+					
+					auto standard = measure(endpoint, reactor, false, unused);
+					auto fast_open = measure(endpoint, reactor, true, carried);
+					
+					examiner << "net.ipv4.tcp_fastopen = " << fast_open_mode() << std::endl;
+					examiner << "Connect then send: " << standard.samples_per_second() << " requests per second" << std::endl;
+					examiner << "Fast open: " << fast_open.samples_per_second() << " requests per second, " << carried << " bytes carried in SYN" << std::endl;
+					
+					examiner.expect(fast_open.samples_per_second()).to(be > 100);
+					
+					// Both ends must have fast open enabled for data to be carried in the SYN:
+					if ((fast_open_mode() & 3) == 3) {
+						examiner.expect(carried).to(be > 0u);
+					}
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,217 @@
+//
+//  Handoff.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Handoff.hpp>
+#include <Async/Network/Server.hpp>
+#include <Async/Reactor.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// A handler which replies to each request with the given byte, so the client can tell which process served it.
+		static Server::Handler reply_with(char byte)
+		{
+			return [byte](Socket & peer, Reactor & reactor){
+				char request;
+				
+				if (peer.receive(&request, 1, reactor))
+					peer.send(&byte, 1, reactor);
+			};
+		}
+		
+		// Adopt the listeners from the predecessor, and serve until it closes the channel.
+		static int run_successor(Socket & channel)
+		{
+			Reactor reactor;
+			Fiber::Pool fibers;
+			
+			int status = 1;
+			bool finished = false;
+			
+			fibers.resume([&]{
+				try {
+					Handoff handoff(channel, reactor);
+					
+					Endpoints endpoints;
+					auto sockets = handoff.receive(endpoints);
+					
+					Server server(endpoints, std::move(sockets), reply_with('b'));
+					server.start();
+					
+					char byte;
+					while (channel.receive(&byte, 1, reactor)) {}
+					
+					server.stop(1.0);
+					status = 0;
+				} catch (std::exception & error) {
+					// The child's exit status can't carry the reason, so report it for the parent's test output:
+					std::cerr << "Successor failed: " << error.what() << std::endl;
+				}
+				
+				finished = true;
+			});
+			
+			while (!finished) reactor.wait(0.1);
+			
+			return status;
+		}
+		
+		UnitTest::Suite HandoffTestSuite {
+			"Async::Network::Handoff",
+			
+			{"it passes listeners within a process",
+				[](UnitTest::Examiner & examiner) {
+					auto channel = Socket::pair();
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					Endpoint endpoint(server);
+					endpoint.set_options(SocketOptions().no_delay().quick_ack());
+					
+					Endpoints endpoints;
+					std::vector<Socket> sockets;
+					
+					fibers.resume([&]{
+						Handoff(channel.first, reactor).send({endpoint}, {server});
+					});
+					
+					fibers.resume([&]{
+						sockets = Handoff(channel.second, reactor).receive(endpoints);
+					});
+					
+					reactor.wait(1.0);
+					
+					examiner.expect(sockets.size()) == 1;
+					examiner.expect(endpoints.size()) == 1;
+					examiner.expect(endpoints.front().address()) == server.local_address();
+					examiner.expect(endpoints.front().options().size()) == endpoint.options().size();
+					examiner.expect(sockets.front().local_address()) == server.local_address();
+				}
+			},
+			
+			{"it hands off listeners to another process without refusing connections",
+				[](UnitTest::Examiner & examiner) {
+					auto channel = Socket::pair();
+					
+					auto child = ::fork();
+					
+					if (child == 0) {
+						// The successor must not hold the predecessor's end, so that it sees the channel close:
+						{Socket other = std::move(channel.first);}
+						
+						::_exit(run_successor(channel.second));
+					}
+					
+					{Socket other = std::move(channel.second);}
+					
+					Server server(Endpoint::named_endpoints("127.0.0.1", 0), reply_with('a'));
+					server.start();
+					
+					auto endpoint = server.endpoints().front();
+					
+					std::atomic<bool> running{true};
+					std::size_t predecessor = 0, successor = 0, failures = 0;
+					
+					std::thread client([&]{
+						Reactor reactor;
+						Fiber::Pool fibers;
+						
+						fibers.resume([&]{
+							while (running) {
+								try {
+									auto socket = endpoint.connect(reactor);
+									char reply = 0;
+									
+									socket.send("x", 1, reactor);
+									socket.receive(&reply, 1, reactor);
+									
+									if (reply == 'a') predecessor += 1;
+									else if (reply == 'b') successor += 1;
+									else failures += 1;
+								} catch (std::system_error &) {
+									failures += 1;
+								}
+							}
+						});
+						
+						while (running) reactor.wait(0.1);
+					});
+					
+					std::this_thread::sleep_for(std::chrono::milliseconds(200));
+					
+					bool handed_off = false;
+					std::string error;
+					
+					{
+						Reactor reactor;
+						Fiber::Pool fibers;
+						bool finished = false;
+						
+						fibers.resume([&]{
+							try {
+								Handoff(channel.first, reactor).send(server);
+								handed_off = true;
+							} catch (std::exception & failure) {
+								error = failure.what();
+							}
+							
+							finished = true;
+						});
+						
+						// Don't wait forever if the successor never takes the listeners:
+						for (std::size_t i = 0; i < 50 && !finished; i += 1) reactor.wait(0.1);
+					}
+					
+					examiner << "Handoff error: " << (error.empty() ? "none" : error) << std::endl;
+					examiner.expect(handed_off) == true;
+					
+					// Stop accepting only once the successor has the listeners:
+					server.stop(1.0);
+					
+					std::this_thread::sleep_for(std::chrono::milliseconds(200));
+					
+					running = false;
+					client.join();
+					
+					::shutdown(channel.first, SHUT_RDWR);
+					
+					int status = 0;
+					::waitpid(child, &status, 0);
+					
+					examiner << "Predecessor: " << predecessor << " Successor: " << successor << std::endl;
+					
+					examiner.expect(predecessor) > 0;
+					examiner.expect(successor) > 0;
+					examiner.expect(failures) == 0;
+					
+					examiner.expect(WIFEXITED(status)) == true;
+					examiner.expect(WEXITSTATUS(status)) == 0;
+				}
+			},
+		};
+	}
+}
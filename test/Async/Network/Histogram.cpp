@@ -0,0 +1,89 @@
+//
+//  Histogram.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Async/Network/Histogram.hpp>
+
+namespace Async
+{
+	namespace Network
+	{
+		using namespace UnitTest::Expectations;
+		
+		UnitTest::Suite HistogramTestSuite {
+			"Async::Network::Histogram",
+			
+			{"it records small values exactly",
+				[](UnitTest::Examiner & examiner) {
+					Histogram histogram;
+					
+					for (std::uint64_t value = 1; value <= 10; value += 1)
+						histogram.record(value);
+					
+					examiner.expect(histogram.count()) == 10u;
+					examiner.expect(histogram.minimum()) == 1u;
+					examiner.expect(histogram.maximum()) == 10u;
+					examiner.expect(histogram.mean()) == 5.5;
+					examiner.expect(histogram.percentile(50)) == 5u;
+					examiner.expect(histogram.percentile(100)) == 10u;
+				}
+			},
+			
+			{"it has contiguous buckets",
+				[](UnitTest::Examiner & examiner) {
+					for (std::size_t index = 1; index < Histogram::BUCKETS; index += 1) {
+						examiner.expect(Histogram::lowest_value(index)) == Histogram::highest_value(index - 1) + 1;
+						examiner.expect(Histogram::index_for(Histogram::lowest_value(index))) == index;
+						examiner.expect(Histogram::index_for(Histogram::highest_value(index))) == index;
+					}
+					
+					examiner.expect(Histogram::highest_value(Histogram::BUCKETS - 1)) == ~std::uint64_t(0);
+				}
+			},
+			
+			{"it reports large percentiles within 3%",
+				[](UnitTest::Examiner & examiner) {
+					Histogram histogram;
+					
+					for (std::uint64_t value = 1; value <= 100000; value += 1)
+						histogram.record(value);
+					
+					for (double percentage : {50.0, 90.0, 99.0, 99.9}) {
+						auto expected = percentage * 1000;
+						auto actual = histogram.percentile(percentage);
+						
+						examiner.expect(actual).to(be >= expected);
+						examiner.expect(actual).to(be <= expected * 1.03);
+					}
+				}
+			},
+			
+			{"it merges histograms",
+				[](UnitTest::Examiner & examiner) {
+					Histogram a, b;
+					
+					a.record(10, 3);
+					b.record(1000);
+					
+					a += b;
+					
+					examiner.expect(a.count()) == 4u;
+					examiner.expect(a.minimum()) == 10u;
+					examiner.expect(a.maximum()) == 1000u;
+					examiner.expect(a.percentile(75)) == 10u;
+					
+					a.clear();
+					
+					examiner.expect(a.count()) == 0u;
+					examiner.expect(a.percentile(50)) == 0u;
+				}
+			},
+		};
+	}
+}
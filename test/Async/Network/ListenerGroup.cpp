@@ -0,0 +1,141 @@
+//
+//  ListenerGroup.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/ListenerGroup.hpp>
+#include <Async/Reactor.hpp>
+
+#include <sys/socket.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		UnitTest::Suite ListenerGroupTestSuite {
+			"Async::Network::ListenerGroup",
+			
+			{"it binds one socket per shard to the same port",
+				[](UnitTest::Examiner & examiner) {
+					ListenerGroup group(Endpoint::named_endpoints("127.0.0.1", 0), 4);
+					
+					examiner.expect(group.shards()) == 4u;
+					
+					auto port = group.endpoints().front().address().port();
+					examiner.expect(port) != 0;
+					
+					for (std::size_t i = 0; i < group.shards(); i += 1) {
+						examiner.expect(group.shard(i).size()) == 1u;
+						examiner.expect(group.shard(i).front().local_address().port()) == port;
+					}
+				}
+			},
+			
+			{"it applies the endpoint's options to every shard",
+				[](UnitTest::Examiner & examiner) {
+					auto endpoint = Endpoint::named_endpoints("127.0.0.1", 0).front();
+					endpoint.set_options(SocketOptions().keep_alive());
+					
+					ListenerGroup group({endpoint}, 2);
+					
+					examiner.expect(group.endpoints().front().options().size()) == 1u;
+					
+					for (std::size_t i = 0; i < group.shards(); i += 1) {
+						int keep_alive = 0;
+						socklen_t size = sizeof(keep_alive);
+						::getsockopt(group.shard(i).front(), SOL_SOCKET, SO_KEEPALIVE, &keep_alive, &size);
+						
+						examiner.expect(keep_alive != 0) == true;
+					}
+				}
+			},
+			
+			{"it accepts connections on every shard",
+				[](UnitTest::Examiner & examiner) {
+					const std::size_t shards = 4, connections = 64;
+					
+					ListenerGroup group(Endpoint::named_endpoints("127.0.0.1", 0), shards);
+					auto endpoint = group.endpoints().front();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::vector<std::size_t> accepted(shards);
+					std::vector<Socket> clients;
+					
+					for (std::size_t i = 0; i < shards; i += 1) {
+						fibers.resume([&, i]{
+							while (true) {
+								auto peer = group.shard(i).front().accept(reactor);
+								accepted[i] += 1;
+							}
+						});
+					}
+					
+					fibers.resume([&]{
+						// Without steering, connections are spread over the shards by a hash of their addresses:
+						for (std::size_t i = 0; i < connections; i += 1) {
+							clients.push_back(endpoint.connect(reactor));
+						}
+					});
+					
+					reactor.wait(0.5);
+					
+					std::size_t total = 0;
+					
+					for (std::size_t i = 0; i < shards; i += 1) {
+						examiner << "shard " << i << ": " << accepted[i] << " connections." << std::endl;
+						examiner.expect(accepted[i]).to(be > 0u);
+						
+						total += accepted[i];
+					}
+					
+					examiner.expect(total) == connections;
+				}
+			},
+			
+			{"it can steer connections by CPU",
+				[](UnitTest::Examiner & examiner) {
+					ListenerGroup group(Endpoint::named_endpoints("127.0.0.1", 0), 2);
+					
+					if (!group.steer_by_cpu()) return;
+					
+					auto endpoint = group.endpoints().front();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t accepted = 0;
+					
+					for (std::size_t i = 0; i < group.shards(); i += 1) {
+						fibers.resume([&, i]{
+							while (true) {
+								auto peer = group.shard(i).front().accept(reactor);
+								accepted += 1;
+							}
+						});
+					}
+					
+					fibers.resume([&]{
+						for (std::size_t i = 0; i < 8; i += 1) {
+							endpoint.connect(reactor);
+						}
+					});
+					
+					reactor.wait(0.5);
+					
+					examiner.expect(accepted) == 8u;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,156 @@
+//
+//  Metrics.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Metrics.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+#include <Async/After.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// With ASYNC_NETWORK_METRICS=0 nothing is counted, and every snapshot is empty.
+		static std::uint64_t counted(std::uint64_t count)
+		{
+			return Metrics::ENABLED ? count : 0;
+		}
+		
+		UnitTest::Suite MetricsTestSuite {
+			"Async::Network::Metrics",
+			
+			{"it counts connections and their waits",
+				[](UnitTest::Examiner & examiner) {
+					auto before = Metrics::snapshot();
+					
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						char buffer[12];
+						peer.receive(buffer, sizeof(buffer), reactor);
+					});
+					
+					fibers.resume([&]{
+						// Give the server time to wait for the connection:
+						After(0.01, reactor).wait();
+						
+						auto client = Endpoint(server).connect(reactor);
+						client.send("Hello World!", 12, reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					auto after = Metrics::snapshot();
+					
+					examiner.expect(after[Metrics::ACCEPTS] - before[Metrics::ACCEPTS]) == counted(1);
+					examiner.expect(after[Metrics::ACCEPT_WAITS] - before[Metrics::ACCEPT_WAITS]).to(be >= counted(1));
+					examiner.expect(after[Metrics::CONNECTS] - before[Metrics::CONNECTS]) == counted(1);
+					examiner.expect(after[Metrics::SENDS] - before[Metrics::SENDS]) == counted(1);
+					examiner.expect(after[Metrics::RECEIVES] - before[Metrics::RECEIVES]) == counted(1);
+					examiner.expect(after[Metrics::RECEIVE_WAITS] - before[Metrics::RECEIVE_WAITS]).to(be >= counted(1));
+					
+					// Waiting is not retrying, which only happens if a system call is interrupted:
+					examiner.expect(after[Metrics::ACCEPT_RETRIES] - before[Metrics::ACCEPT_RETRIES]) == 0u;
+					examiner.expect(after[Metrics::RECEIVE_RETRIES] - before[Metrics::RECEIVE_RETRIES]) == 0u;
+					
+					auto & accept_wait = after[Metrics::ACCEPT_WAIT];
+					
+					examiner.expect(accept_wait.count() - before[Metrics::ACCEPT_WAIT].count()) == counted(1);
+					examiner.expect(accept_wait.maximum()).to(be >= counted(5000));
+				}
+			},
+			
+			{"it counts errors by number",
+				[](UnitTest::Examiner & examiner) {
+					Address address;
+					
+					{
+						// Nothing is listening on this port once the socket is closed:
+						auto socket = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+						address = socket.local_address();
+					}
+					
+					auto before = Metrics::snapshot();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					fibers.resume([&]{
+						Socket socket(address.family(), SOCK_STREAM);
+						
+						try {
+							socket.connect(address, reactor);
+						} catch (std::system_error &) {
+						}
+					});
+					
+					reactor.wait(0.1);
+					
+					auto after = Metrics::snapshot();
+					
+					examiner.expect(after.errors_for(ECONNREFUSED) - before.errors_for(ECONNREFUSED)) == counted(1);
+					examiner.expect(after[Metrics::ERRORS] - before[Metrics::ERRORS]) == counted(1);
+				}
+			},
+			
+			{"it aggregates across threads",
+				[](UnitTest::Examiner & examiner) {
+					const std::size_t threads = 4, messages = 1000;
+					
+					auto before = Metrics::snapshot();
+					
+					std::vector<std::thread> workers;
+					
+					for (std::size_t i = 0; i < threads; i += 1) {
+						workers.emplace_back([&]{
+							Reactor reactor;
+							Fiber::Pool fibers;
+							
+							auto sockets = Socket::pair();
+							
+							fibers.resume([&]{
+								char byte = 'x';
+								
+								for (std::size_t j = 0; j < messages; j += 1) {
+									sockets.first.send(&byte, 1, reactor);
+									sockets.second.receive(&byte, 1, reactor);
+								}
+							});
+							
+							reactor.wait(0.1);
+						});
+					}
+					
+					for (auto & worker : workers) worker.join();
+					
+					auto after = Metrics::snapshot();
+					
+					examiner.expect(after[Metrics::SENDS] - before[Metrics::SENDS]) == counted(threads * messages);
+					examiner.expect(after[Metrics::RECEIVES] - before[Metrics::RECEIVES]) == counted(threads * messages);
+					
+					examiner << Metrics::name(Metrics::SENDS) << ": " << after[Metrics::SENDS] << std::endl;
+				}
+			},
+		};
+	}
+}
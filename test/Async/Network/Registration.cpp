@@ -0,0 +1,163 @@
+//
+//  Registration.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Network/Registration.hpp>
+#include <Async/Reactor.hpp>
+
+#include <vector>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// Echo single byte messages between a pair of sockets, returning the number of round trips.
+		static std::size_t ping_pong(std::pair<Socket, Socket> & sockets, Reactor & reactor)
+		{
+			Fiber::Pool fibers;
+			std::size_t count = 0;
+			
+			fibers.resume([&]{
+				char byte;
+				
+				while (sockets.second.receive(&byte, 1, reactor)) {
+					sockets.second.send(&byte, 1, reactor);
+				}
+			});
+			
+			fibers.resume([&]{
+				char byte = 'x';
+				
+				while (true) {
+					sockets.first.send(&byte, 1, reactor);
+					sockets.first.receive(&byte, 1, reactor);
+					
+					count += 1;
+				}
+			});
+			
+			reactor.wait(0.2);
+			
+			return count;
+		}
+		
+		UnitTest::Suite RegistrationTestSuite {
+			"Async::Network::Registration",
+			
+			{"it can attach and detach a socket",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					auto sockets = Socket::pair();
+					
+					examiner.expect(sockets.first.is_attached()) == false;
+					
+					sockets.first.attach(reactor);
+					examiner.expect(sockets.first.is_attached()) == true;
+					
+					// Copies are registered separately, if at all:
+					Socket copy = sockets.first;
+					examiner.expect(copy.is_attached()) == false;
+					
+					Socket moved = std::move(sockets.first);
+					examiner.expect(moved.is_attached()) == true;
+					
+					moved.detach();
+					examiner.expect(moved.is_attached()) == false;
+				}
+			},
+			
+			{"it can exchange messages using a persistent registration",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					auto sockets = Socket::pair();
+					
+					sockets.first.attach(reactor);
+					sockets.second.attach(reactor);
+					
+					auto count = ping_pong(sockets, reactor);
+					
+					examiner << "Round trips: " << count << std::endl;
+					examiner.expect(count) > 100;
+					
+					// Every round trip has to wait for the reply:
+					examiner.expect(sockets.first.registration()->waits()) >= count;
+				}
+			},
+			
+			{"it can read and write concurrently",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					auto sockets = Socket::pair();
+					sockets.first.attach(reactor);
+					sockets.second.attach(reactor);
+					
+					// Much larger than the socket buffer, so the writer has to wait:
+					std::vector<char> buffer(1024*1024*4, 'x');
+					char reply = 0;
+					
+					fibers.resume([&]{
+						sockets.first.send(buffer.data(), buffer.size(), reactor);
+					});
+					
+					// Waits to read while the writer is waiting on the same socket:
+					fibers.resume([&]{
+						sockets.first.receive(&reply, 1, reactor);
+					});
+					
+					fibers.resume([&]{
+						std::vector<char> input(1024*64);
+						std::size_t total = 0;
+						
+						while (total < buffer.size()) {
+							total += sockets.second.receive(input.data(), input.size(), reactor);
+						}
+						
+						sockets.second.send("!", 1, reactor);
+					});
+					
+					reactor.wait(2.0);
+					
+					examiner.expect(reply) == '!';
+				}
+			},
+			
+			{"it is only used by the reactor it was attached to",
+				[](UnitTest::Examiner & examiner) {
+					Reactor attached, other;
+					Fiber::Pool fibers;
+					
+					auto sockets = Socket::pair();
+					sockets.first.attach(attached);
+					
+					char byte = 0;
+					
+					fibers.resume([&]{
+						sockets.first.receive(&byte, 1, other);
+					});
+					
+					fibers.resume([&]{
+						sockets.second.send("x", 1, other);
+					});
+					
+					other.wait(1.0);
+					
+					examiner.expect(byte) == 'x';
+					examiner.expect(sockets.first.registration()->waits()) == 0;
+				}
+			},
+		};
+	}
+}
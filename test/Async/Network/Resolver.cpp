@@ -0,0 +1,321 @@
+//
+//  Resolver.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Resolver.hpp>
+#include <Async/Reactor.hpp>
+#include <Async/Readable.hpp>
+
+#include <Time/Statistics.hpp>
+#include <Time/Timer.hpp>
+
+#include <sys/socket.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// A minimal DNS server which answers every A query with 127.0.0.1 and every AAAA query with ::1. The first drop queries are ignored, as if lost, and AAAA queries fail with SERVFAIL if fail_ipv6 is set. If malformed is set, each answer is preceded by a reply which claims records it doesn't contain.
+		static void serve_stub_dns(Socket & socket, Reactor & reactor, std::size_t & queries, std::size_t drop = 0, bool fail_ipv6 = false, bool malformed = false)
+		{
+			Readable event(socket, reactor);
+			
+			unsigned char buffer[512];
+			sockaddr_storage peer;
+			
+			while (true) {
+				socklen_t peer_size = sizeof(peer);
+				auto size = ::recvfrom(socket, buffer, sizeof(buffer), 0, reinterpret_cast<sockaddr *>(&peer), &peer_size);
+				
+				if (size == -1) {
+					event.wait();
+					continue;
+				}
+				
+				queries += 1;
+				
+				if (queries <= drop) continue;
+				
+				std::string response(reinterpret_cast<char *>(buffer), size);
+				auto type = (buffer[size-4] << 8) | buffer[size-3];
+				
+				if (type == 28 && fail_ipv6) {
+					response[2] = '\x81'; response[3] = '\x82';
+					
+					::sendto(socket, response.data(), response.size(), 0, reinterpret_cast<sockaddr *>(&peer), peer_size);
+					continue;
+				}
+				
+				if (malformed) {
+					auto truncated = response;
+					truncated[2] = '\x81'; truncated[3] = '\x80';
+					truncated[6] = 0; truncated[7] = 5;
+					
+					::sendto(socket, truncated.data(), truncated.size(), 0, reinterpret_cast<sockaddr *>(&peer), peer_size);
+				}
+				
+				response[2] = '\x81'; response[3] = '\x80';
+				response[6] = 0; response[7] = 1;
+				
+				// Compressed name pointing at the question, type, class IN, TTL 60:
+				response.append("\xC0\x0C", 2);
+				response.push_back(static_cast<char>(type >> 8));
+				response.push_back(static_cast<char>(type & 0xFF));
+				response.append("\x00\x01\x00\x00\x00\x3C", 6);
+				
+				if (type == 28) {
+					response.append("\x00\x10", 2);
+					response.append(15, '\0');
+					response.push_back(1);
+				} else {
+					response.append("\x00\x04\x7F\x00\x00\x01", 6);
+				}
+				
+				::sendto(socket, response.data(), response.size(), 0, reinterpret_cast<sockaddr *>(&peer), peer_size);
+			}
+		}
+		
+		static Socket bind_stub_dns()
+		{
+			auto endpoint = Endpoint::named_endpoints("127.0.0.1", 0, SOCK_DGRAM).front();
+			
+			return endpoint.bind();
+		}
+		
+		UnitTest::Suite ResolverTestSuite {
+			"Async::Network::Resolver",
+			
+			{"it can parse name servers",
+				[](UnitTest::Examiner & examiner) {
+					auto nameservers = Resolver::nameservers_for_path("/this/path/does/not/exist");
+					
+					examiner.expect(nameservers.size()) == 1u;
+					examiner.expect(nameservers.front().address().port()) == 53;
+					
+					examiner.expect(Resolver::port_for_service("http", SOCK_STREAM)) == 80;
+					examiner.expect(Resolver::port_for_service(8080, SOCK_STREAM)) == 8080;
+				}
+			},
+			
+			{"it can resolve names using a local server",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					auto server = bind_stub_dns();
+					std::size_t queries = 0;
+					
+					Resolver resolver({Endpoint(server)}, reactor);
+					Endpoints endpoints;
+					Resolver::TTL ttl = 0;
+					
+					fibers.resume([&]{
+						serve_stub_dns(server, reactor, queries);
+					});
+					
+					fibers.resume([&]{
+						endpoints = resolver.named_endpoints("www.example.test", "http", SOCK_STREAM, &ttl);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(endpoints.size()) == 2u;
+					examiner.expect(ttl) == 60u;
+					examiner.expect(queries) == 2u;
+					
+					examiner.expect(endpoints.front().address().family()) == AF_INET6;
+					examiner.expect(endpoints.back().address().canonical_name()) == "127.0.0.1";
+					examiner.expect(endpoints.back().address().port()) == 80;
+				}
+			},
+			
+			{"it sends queries again if the answers are lost",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					auto server = bind_stub_dns();
+					std::size_t queries = 0;
+					
+					Resolver resolver({Endpoint(server)}, reactor);
+					resolver.set_timeout(0.05);
+					
+					Endpoints endpoints;
+					
+					fibers.resume([&]{
+						serve_stub_dns(server, reactor, queries, 2);
+					});
+					
+					fibers.resume([&]{
+						endpoints = resolver.named_endpoints("www.example.test", "http");
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(endpoints.size()) == 2u;
+					examiner.expect(queries) == 4u;
+				}
+			},
+			
+			{"it tries the next name server if one doesn't answer",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					// Nothing reads from the first server, so its queries are never answered:
+					auto silent = bind_stub_dns();
+					auto server = bind_stub_dns();
+					std::size_t queries = 0;
+					
+					Resolver resolver({Endpoint(silent), Endpoint(server)}, reactor);
+					resolver.set_timeout(0.02, 2);
+					
+					Endpoints endpoints;
+					
+					fibers.resume([&]{
+						serve_stub_dns(server, reactor, queries);
+					});
+					
+					fibers.resume([&]{
+						endpoints = resolver.named_endpoints("www.example.test", "http");
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(endpoints.size()) == 2u;
+					examiner.expect(resolver.queries()) == 6u;
+				}
+			},
+			
+			{"it keeps the answers it has if one type fails",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					auto server = bind_stub_dns();
+					std::size_t queries = 0;
+					
+					Resolver resolver({Endpoint(server)}, reactor);
+					Endpoints endpoints;
+					
+					fibers.resume([&]{
+						serve_stub_dns(server, reactor, queries, 0, true);
+					});
+					
+					fibers.resume([&]{
+						endpoints = resolver.named_endpoints("www.example.test", "http");
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(endpoints.size()) == 1u;
+					examiner.expect(endpoints.front().address().canonical_name()) == "127.0.0.1";
+				}
+			},
+			
+			{"it ignores malformed replies",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					auto server = bind_stub_dns();
+					std::size_t queries = 0;
+					
+					Resolver resolver({Endpoint(server)}, reactor);
+					Endpoints endpoints;
+					
+					fibers.resume([&]{
+						serve_stub_dns(server, reactor, queries, 0, false, true);
+					});
+					
+					fibers.resume([&]{
+						endpoints = resolver.named_endpoints("www.example.test", "http");
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(endpoints.size()) == 2u;
+					examiner.expect(queries) == 2u;
+				}
+			},
+			
+			{"it shares queries for the same name",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					auto server = bind_stub_dns();
+					std::size_t queries = 0, resolved = 0;
+					
+					Resolver resolver({Endpoint(server)}, reactor);
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						fibers.resume([&]{
+							auto endpoints = resolver.named_endpoints("www.example.test", 443);
+							
+							if (endpoints.size() == 2) resolved += 1;
+						});
+					}
+					
+					fibers.resume([&]{
+						serve_stub_dns(server, reactor, queries);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(resolved) == 10u;
+					examiner.expect(queries) == 2u;
+					examiner.expect(resolver.queries()) == 2u;
+				}
+			},
+			
+			{"it resolves quickly",
+				[](UnitTest::Examiner & examiner) {
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					auto server = bind_stub_dns();
+					std::size_t queries = 0;
+					
+					Resolver resolver({Endpoint(server)}, reactor);
+					Time::Statistics statistics;
+					
+					fibers.resume([&]{
+						serve_stub_dns(server, reactor, queries);
+					});
+					
+					for (std::size_t i = 0; i < 4; i += 1) {
+						fibers.resume([&, i]{
+							Fiber::current->annotate("resolver");
+							
+							auto host = "host-" + std::to_string(i) + ".example.test";
+							
+							while (true) {
+								auto sample = statistics.sample();
+								
+								resolver.named_endpoints(host, 80);
+							}
+						});
+					}
+					
+					reactor.wait(1.0);
+					
+					examiner << "Samples per second: " << statistics.samples_per_second() << std::endl;
+					examiner << "Minimum duration: " << statistics.minimum_duration() << std::endl;
+					examiner << "Maximum duration: " << statistics.maximum_duration() << std::endl;
+					examiner.expect(statistics.samples_per_second()).to(be > 100);
+				}
+			},
+		};
+	}
+}
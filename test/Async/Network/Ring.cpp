@@ -0,0 +1,229 @@
+//
+//  Ring.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Ring.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+
+#include <Time/Statistics.hpp>
+
+#include <memory>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		UnitTest::Suite RingTestSuite {
+			"Async::Network::Ring",
+			
+			{"it accepts, connects, sends and receives",
+				[](UnitTest::Examiner & examiner) {
+					examiner << "io_uring supported: " << Ring::supported() << std::endl;
+					
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Ring ring(reactor);
+					Fiber::Pool fibers;
+					
+					std::string received;
+					
+					fibers.resume([&]{
+						auto peer = ring.accept(server);
+						
+						char buffer[32];
+						auto size = ring.receive(peer, buffer, sizeof(buffer));
+						ring.send(peer, buffer, size);
+					});
+					
+					fibers.resume([&]{
+						Socket client(PF_INET, SOCK_STREAM);
+						ring.connect(client, server.local_address());
+						
+						ring.send(client, "Hello World!", 12);
+						
+						char buffer[32];
+						auto size = ring.receive(client, buffer, sizeof(buffer));
+						received.assign(buffer, size);
+					});
+					
+					reactor.wait(0.5);
+					
+					examiner.expect(received) == "Hello World!";
+				}
+			},
+			
+			{"it sends all of a large buffer",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Ring ring(reactor);
+					Fiber::Pool fibers;
+					
+					// Larger than the socket buffers, so a single send can't complete it:
+					const std::size_t size = 16 * 1024 * 1024;
+					std::size_t sent = 0, received = 0;
+					
+					fibers.resume([&]{
+						auto peer = ring.accept(server);
+						
+						std::vector<char> buffer(64 * 1024);
+						while (auto count = ring.receive(peer, buffer.data(), buffer.size())) received += count;
+					});
+					
+					fibers.resume([&]{
+						Socket client(PF_INET, SOCK_STREAM);
+						ring.connect(client, server.local_address());
+						
+						std::vector<char> buffer(size, 'x');
+						sent = ring.send(client, buffer.data(), buffer.size());
+					});
+					
+					reactor.wait(1.0);
+					
+					examiner.expect(sent) == size;
+					examiner.expect(received) == size;
+				}
+			},
+			
+			{"it can accept with multishot",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					auto address = server.local_address();
+					std::vector<Socket> clients;
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						Socket client(PF_INET, SOCK_STREAM);
+						::connect(client, address.data(), address.size());
+						
+						clients.push_back(std::move(client));
+					}
+					
+					Reactor reactor;
+					Ring ring(reactor);
+					Fiber::Pool fibers;
+					
+					std::size_t accepted = 0;
+					
+					fibers.resume([&]{
+						ring.accept_each(server, [&](Socket &&){
+							accepted += 1;
+						});
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(accepted) == 10u;
+				}
+			},
+			
+			{"it can receive into provided buffers",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Ring ring(reactor);
+					Ring::Buffers buffers(ring, 1, 8, 64);
+					Fiber::Pool fibers;
+					
+					std::string received;
+					
+					fibers.resume([&]{
+						auto peer = ring.accept(server);
+						
+						while (received.size() < 24) {
+							auto size = ring.receive(peer, buffers, [&](const char * data, std::size_t size){
+								received.append(data, size);
+							});
+							
+							if (size == 0) break;
+						}
+					});
+					
+					fibers.resume([&]{
+						Socket client(PF_INET, SOCK_STREAM);
+						ring.connect(client, server.local_address());
+						
+						ring.send(client, "Hello World!", 12);
+						ring.send(client, "Hello World!", 12);
+						
+						// Keep the connection open until the data has been received:
+						char buffer[1];
+						ring.receive(client, buffer, sizeof(buffer));
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(received.size()) == 24u;
+					examiner.expect(received.substr(0, 12)) == "Hello World!";
+				}
+			},
+			
+			{"it echoes messages quickly",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Ring ring(reactor);
+					Fiber::Pool fibers;
+					
+					Time::Statistics statistics;
+					
+					fibers.resume([&]{
+						ring.accept_each(server, [&](Socket && socket){
+							auto peer = std::make_shared<Socket>(std::move(socket));
+							
+							fibers.resume([&ring, peer]{
+								char buffer[12];
+								
+								while (auto size = ring.receive(*peer, buffer, sizeof(buffer))) {
+									ring.send(*peer, buffer, size);
+								}
+							});
+						});
+					});
+					
+					for (std::size_t i = 0; i < 8; i += 1) {
+						fibers.resume([&]{
+							Socket client(PF_INET, SOCK_STREAM);
+							ring.connect(client, server.local_address());
+							
+							char buffer[12];
+							
+							while (true) {
+								auto sample = statistics.sample();
+								
+								ring.send(client, "Hello World!", 12);
+								ring.receive(client, buffer, sizeof(buffer));
+							}
+						});
+					}
+					
+					reactor.wait(1.0);
+					
+					examiner << "Ring enabled: " << ring.enabled() << std::endl;
+					examiner << "Samples per second: " << statistics.samples_per_second() << std::endl;
+					examiner.expect(statistics.samples_per_second()).to(be > 100);
+				}
+			},
+		};
+	}
+}
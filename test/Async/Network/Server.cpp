@@ -0,0 +1,287 @@
+//
+//  Server.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Server.hpp>
+#include <Async/After.hpp>
+#include <Async/Reactor.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// Read until the peer shuts down the connection.
+		static void wait_for_close(Socket & peer, Reactor & reactor)
+		{
+			char buffer[64];
+			
+			while (peer.receive(buffer, sizeof(buffer), reactor)) {}
+		}
+		
+		UnitTest::Suite ServerTestSuite {
+			"Async::Network::Server",
+			
+			{"it echoes data on several threads",
+				[](UnitTest::Examiner & examiner) {
+					Server server(Endpoint::named_endpoints("127.0.0.1", 0), [](Socket & peer, Reactor & reactor){
+						char byte;
+						
+						while (peer.receive(&byte, 1, reactor)) {
+							peer.send(&byte, 1, reactor);
+						}
+					});
+					
+					server.start(2);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					std::size_t replies = 0;
+					
+					for (std::size_t i = 0; i < 10; i += 1) {
+						fibers.resume([&]{
+							auto client = server.endpoints().front().connect(reactor);
+							char byte = 'x';
+							
+							client.send(&byte, 1, reactor);
+							client.receive(&byte, 1, reactor);
+							
+							if (byte == 'x') replies += 1;
+						});
+					}
+					
+					reactor.wait(1.0);
+					
+					examiner.expect(replies) == 10;
+					examiner.expect(server.accepted()) == 10;
+				}
+			},
+			
+			{"it leaves connections in the backlog when saturated",
+				[](UnitTest::Examiner & examiner) {
+					Server server(Endpoint::named_endpoints("127.0.0.1", 0), wait_for_close, 1);
+					server.start(1);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					Socket first, second;
+					
+					fibers.resume([&]{
+						first = server.endpoints().front().connect(reactor);
+						second = server.endpoints().front().connect(reactor);
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(server.connections()) == 1;
+					examiner.expect(server.accepted()) == 1;
+					examiner.expect(server.paused()) >= 1;
+					examiner.expect(server.queued()) == 1;
+					
+					// Finishing the first connection makes room for the second:
+					first.shutdown_write();
+					reactor.wait(0.2);
+					
+					examiner.expect(server.connections()) == 1;
+					examiner.expect(server.accepted()) == 2;
+					examiner.expect(server.queued()) == 0;
+				}
+			},
+			
+			{"it limits connections across several listeners",
+				[](UnitTest::Examiner & examiner) {
+					auto endpoints = Endpoint::named_endpoints("127.0.0.1", 0);
+					endpoints.push_back(endpoints.front());
+					
+					Server server(endpoints, wait_for_close, 1);
+					server.start(1);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					std::vector<Socket> clients;
+					
+					fibers.resume([&]{
+						for (auto & endpoint : server.endpoints()) {
+							clients.push_back(endpoint.connect(reactor));
+						}
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(clients.size()) == 2u;
+					examiner.expect(server.connections()) == 1u;
+					examiner.expect(server.accepted()) == 1u;
+				}
+			},
+			
+			{"it can shed load when the backlog is too deep",
+				[](UnitTest::Examiner & examiner) {
+					Server server(Endpoint::named_endpoints("127.0.0.1", 0), wait_for_close, 1);
+					server.set_shed_threshold(1);
+					server.start(1);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					std::vector<Socket> clients;
+					
+					fibers.resume([&]{
+						for (std::size_t i = 0; i < 4; i += 1) {
+							clients.push_back(server.endpoints().front().connect(reactor));
+						}
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(server.accepted()) == 1;
+					examiner.expect(server.shed()) == 2;
+					examiner.expect(server.queued()) == 1;
+				}
+			},
+			
+			{"it applies the endpoint's options to accepted connections",
+				[](UnitTest::Examiner & examiner) {
+					auto endpoints = Endpoint::named_endpoints("127.0.0.1", 0);
+					
+					// Quick acknowledgement is on by default, and isn't inherited from the listener:
+					endpoints.front().set_options(SocketOptions().quick_ack(false));
+					
+					int quick_ack = -1;
+					
+					Server server(endpoints, [&](Socket & peer, Reactor &){
+						socklen_t size = sizeof(quick_ack);
+						::getsockopt(peer, IPPROTO_TCP, TCP_QUICKACK, &quick_ack, &size);
+					});
+					
+					examiner.expect(server.endpoints().front().options().size()) == 1u;
+					
+					server.start(1);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					fibers.resume([&]{
+						auto client = server.endpoints().front().connect(reactor);
+						wait_for_close(client, reactor);
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(server.accepted()) == 1;
+					examiner.expect(quick_ack) == 0;
+				}
+			},
+			
+			{"it keeps accepting after running out of descriptors",
+				[](UnitTest::Examiner & examiner) {
+					Server server(Endpoint::named_endpoints("127.0.0.1", 0), wait_for_close);
+					server.start(1);
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					// Created before the limit is lowered, so connecting doesn't need any more descriptors:
+					std::vector<Socket> clients;
+					for (std::size_t i = 0; i < 4; i += 1) clients.emplace_back(PF_INET, SOCK_STREAM);
+					
+					// Give the server thread time to create its reactor:
+					std::this_thread::sleep_for(std::chrono::milliseconds(50));
+					
+					rlimit limit;
+					::getrlimit(RLIMIT_NOFILE, &limit);
+					auto original = limit;
+					
+					// The lowest free descriptor, so no more can be created:
+					auto next = ::dup(0);
+					::close(next);
+					
+					limit.rlim_cur = next;
+					::setrlimit(RLIMIT_NOFILE, &limit);
+					
+					fibers.resume([&]{
+						for (auto & client : clients) client.connect(server.endpoints().front().address(), reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					auto accepted = server.accepted();
+					::setrlimit(RLIMIT_NOFILE, &original);
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(accepted) == 0;
+					examiner.expect(server.exhausted()) >= 1;
+					examiner.expect(server.accepted()) == 4;
+				}
+			},
+			
+			{"it drains connections when stopped",
+				[](UnitTest::Examiner & examiner) {
+					Server server(Endpoint::named_endpoints("127.0.0.1", 0), [](Socket & peer, Reactor & reactor){
+						char byte;
+						peer.receive(&byte, 1, reactor);
+						
+						After(0.2, reactor).wait();
+						
+						peer.send("!", 1, reactor);
+					});
+					
+					server.start(1);
+					
+					char reply = 0;
+					
+					std::thread client([&]{
+						Reactor reactor;
+						Fiber::Pool fibers;
+						
+						fibers.resume([&]{
+							auto client = server.endpoints().front().connect(reactor);
+							
+							client.send("x", 1, reactor);
+							client.receive(&reply, 1, reactor);
+						});
+						
+						reactor.wait(1.0);
+					});
+					
+					std::this_thread::sleep_for(std::chrono::milliseconds(100));
+					server.stop(1.0);
+					client.join();
+					
+					examiner.expect(reply) == '!';
+					
+					// The listening socket is still open, so new connections are queued rather than refused:
+					Reactor reactor;
+					Fiber::Pool fibers;
+					bool connected = false;
+					
+					fibers.resume([&]{
+						server.endpoints().front().connect(reactor);
+						connected = true;
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(connected) == true;
+					examiner.expect(server.accepted()) == 1;
+				}
+			},
+		};
+	}
+}
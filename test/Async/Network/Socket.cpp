@@ -253,6 +253,118 @@ namespace Async
 					examiner.expect(client_statistics.samples_per_second()).to(be > 100);
 				}
 			},
+			
+			{"it can send and receive buffer sequences",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::string header, body;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						char header_buffer[6] = {0}, body_buffer[12] = {0};
+						iovec buffers[] = {{header_buffer, sizeof(header_buffer)}, {body_buffer, sizeof(body_buffer)}};
+						
+						std::size_t total = 0;
+						while (total < sizeof(header_buffer) + sizeof(body_buffer)) {
+							auto size = peer.receive(buffers, 2, reactor);
+							if (size == 0) break;
+							
+							total += size;
+							
+							// Advance through the buffers for the next receive:
+							for (auto & buffer : buffers) {
+								auto used = std::min(size, buffer.iov_len);
+								buffer.iov_base = static_cast<char *>(buffer.iov_base) + used;
+								buffer.iov_len -= used;
+								size -= used;
+							}
+						}
+						
+						header.assign(header_buffer, sizeof(header_buffer));
+						body.assign(body_buffer, sizeof(body_buffer));
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						
+						char header_data[] = "LEN=12", body_data[] = "Hello World!";
+						iovec buffers[] = {{header_data, 6}, {body_data, 12}};
+						
+						client.send(buffers, 2, reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(header) == "LEN=12";
+					examiner.expect(body) == "Hello World!";
+				}
+			},
+			
+			{"it can send and receive framed messages quickly",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					Time::Statistics statistics;
+					
+					fibers.resume([&]{
+						Fiber::Pool connections;
+						
+						while (true) {
+							auto peer = server.accept(reactor);
+							
+							connections.resume([&, peer]() mutable {
+								char buffer[64];
+								
+								while (true) {
+									auto size = peer.receive(buffer, sizeof(buffer), reactor);
+									if (size == 0) break;
+									
+									peer.send(buffer, size, reactor);
+								}
+							});
+						}
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						
+						char header[4] = {0, 0, 0, 12}, body[] = "Hello World!", reply[16];
+						iovec buffers[] = {{header, sizeof(header)}, {body, 12}};
+						
+						while (true) {
+							auto sample = statistics.sample();
+							
+							// The header and body go out in one system call without being concatenated:
+							client.send(buffers, 2, reactor);
+							
+							std::size_t received = 0;
+							while (received < sizeof(reply)) {
+								received += client.receive(reply + received, sizeof(reply) - received, reactor);
+							}
+						}
+					});
+					
+					reactor.wait(1.0);
+					
+					examiner << "Samples per second: " << statistics.samples_per_second() << std::endl;
+					examiner << "Minimum duration: " << statistics.minimum_duration() << std::endl;
+					examiner << "Maximum duration: " << statistics.maximum_duration() << std::endl;
+					examiner.expect(statistics.samples_per_second()).to(be > 100);
+				}
+			},
 		};
 	}
 }
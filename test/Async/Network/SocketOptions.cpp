@@ -0,0 +1,134 @@
+//
+//  SocketOptions.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Acceptor.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		static int get_option(const Socket & socket, int level, int name)
+		{
+			int value = 0;
+			socklen_t size = sizeof(value);
+			
+			::getsockopt(socket, level, name, &value, &size);
+			
+			return value;
+		}
+		
+		UnitTest::Suite SocketOptionsTestSuite {
+			"Async::Network::SocketOptions",
+			
+			{"it respects reuse_address when binding",
+				[](UnitTest::Examiner & examiner) {
+					auto endpoint = Endpoint::named_endpoints("127.0.0.1", 0).front();
+					
+					examiner.expect(get_option(endpoint.bind(), SOL_SOCKET, SO_REUSEADDR) != 0) == true;
+					examiner.expect(get_option(endpoint.bind(false), SOL_SOCKET, SO_REUSEADDR)) == 0;
+					
+					// Options attached to the endpoint take precedence:
+					endpoint.set_options(SocketOptions().reuse_address(false));
+					examiner.expect(get_option(endpoint.bind(), SOL_SOCKET, SO_REUSEADDR)) == 0;
+					
+					// Binding with other options reuses the address in the same way:
+					examiner.expect(get_option(endpoint.bind(SocketOptions().no_delay()), SOL_SOCKET, SO_REUSEADDR) != 0) == true;
+					examiner.expect(get_option(endpoint.bind(SocketOptions().no_delay(), false), SOL_SOCKET, SO_REUSEADDR)) == 0;
+				}
+			},
+			
+			{"it applies options attached to an endpoint",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Endpoint endpoint(server);
+					endpoint.set_options(SocketOptions().no_delay().keep_alive().receive_buffer(64 * 1024).type_of_service(0x10));
+					
+					examiner.expect(endpoint.options().size()) == 4u;
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					int no_delay = 0, keep_alive = 0, receive_buffer = 0, type_of_service = 0;
+					
+					fibers.resume([&]{
+						auto socket = endpoint.connect(reactor);
+						
+						no_delay = get_option(socket, IPPROTO_TCP, TCP_NODELAY);
+						keep_alive = get_option(socket, SOL_SOCKET, SO_KEEPALIVE);
+						receive_buffer = get_option(socket, SOL_SOCKET, SO_RCVBUF);
+						type_of_service = get_option(socket, IPPROTO_IP, IP_TOS);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(no_delay != 0) == true;
+					examiner.expect(keep_alive != 0) == true;
+					// Linux doubles the requested size to allow for bookkeeping overhead:
+					examiner.expect(receive_buffer).to(be >= 64 * 1024);
+					examiner.expect(type_of_service) == 0x10;
+				}
+			},
+			
+			{"it skips TCP options on datagram sockets",
+				[](UnitTest::Examiner & examiner) {
+					auto endpoint = Endpoint::named_endpoints("127.0.0.1", 0, SOCK_DGRAM).front();
+					endpoint.set_options(SocketOptions().no_delay().send_buffer(32 * 1024));
+					
+					auto socket = endpoint.bind();
+					
+					examiner.expect(get_option(socket, SOL_SOCKET, SO_SNDBUF)).to(be >= 32 * 1024);
+				}
+			},
+			
+			{"accepted sockets have the listener's options",
+				[](UnitTest::Examiner & examiner) {
+					auto endpoint = Endpoint::named_endpoints("127.0.0.1", 0).front();
+					
+					SocketOptions options;
+					options.no_delay().quick_ack();
+					
+					auto server = endpoint.bind(options);
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					int no_delay = 0;
+					
+					fibers.resume([&]{
+						Acceptor acceptor(server, reactor, 64, options);
+						
+						auto peer = acceptor.accept();
+						no_delay = get_option(peer, IPPROTO_TCP, TCP_NODELAY);
+					});
+					
+					fibers.resume([&]{
+						Endpoint(server).connect(reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(no_delay != 0) == true;
+				}
+			},
+		};
+	}
+}
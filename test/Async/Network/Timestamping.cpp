@@ -0,0 +1,198 @@
+//
+//  Timestamping.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Timestamping.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Network/Deadline.hpp>
+#include <Async/Reactor.hpp>
+
+#include <vector>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		UnitTest::Suite TimestampingTestSuite {
+			"Async::Network::Timestamping",
+			
+			{"it timestamps sent and received data",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					bool enabled = false;
+					std::uint32_t identifier = 0;
+					Timestamping::Nanoseconds before = 0, received = 0, after = 0;
+					std::vector<Timestamping::Completion> completions;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						char buffer[12];
+						auto size = peer.receive(buffer, sizeof(buffer), reactor);
+						peer.send(buffer, size, reactor);
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						Timestamping timestamping(client, reactor, true);
+						enabled = timestamping.enabled();
+						
+						before = Timestamping::now();
+						identifier = timestamping.send("Hello World!", 12);
+						
+						char buffer[12];
+						timestamping.receive(buffer, sizeof(buffer), received);
+						after = Timestamping::now();
+						
+						timestamping.collect();
+						
+						Timestamping::Completion completion;
+						while (timestamping.pop(completion)) completions.push_back(completion);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(enabled) == true;
+					examiner.expect(identifier) == 11u;
+					
+					examiner.expect(received).to(be > before);
+					examiner.expect(received).to(be < after);
+					
+					bool scheduled = false, sent = false;
+					
+					for (auto & completion : completions) {
+						examiner.expect(completion.identifier) == identifier;
+						examiner.expect(completion.time).to(be >= before);
+						examiner.expect(completion.time).to(be <= after);
+						
+						// The acknowledgement may be processed with the response, after it was received:
+						if (completion.stage != Timestamping::ACKNOWLEDGED)
+							examiner.expect(completion.time).to(be <= received);
+						
+						if (completion.stage == Timestamping::SCHEDULED) scheduled = true;
+						if (completion.stage == Timestamping::SENT) sent = true;
+					}
+					
+					examiner << "Kernel send: " << (completions.empty() ? 0 : completions.front().time - before) << "ns, wakeup: " << (after - received) << "ns" << std::endl;
+					
+					examiner.expect(scheduled) == true;
+					examiner.expect(sent) == true;
+				}
+			},
+			
+			{"it only reports completions for the last byte of each send",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					// Larger than the socket buffers, so the send takes several system calls:
+					const std::size_t size = 16 * 1024 * 1024;
+					std::vector<std::uint32_t> identifiers;
+					std::vector<Timestamping::Completion> completions;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						std::vector<char> buffer(64 * 1024);
+						std::size_t received = 0;
+						
+						while (received < size + 1) received += peer.receive(buffer.data(), buffer.size(), reactor);
+						
+						peer.send("!", 1, reactor);
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						Timestamping timestamping(client, reactor);
+						
+						std::vector<char> buffer(size, 'x');
+						identifiers.push_back(timestamping.send(buffer.data(), buffer.size()));
+						identifiers.push_back(timestamping.send("!", 1));
+						
+						Timestamping::Nanoseconds received;
+						timestamping.receive(buffer.data(), 1, received);
+						
+						timestamping.collect();
+						
+						Timestamping::Completion completion;
+						while (timestamping.pop(completion)) completions.push_back(completion);
+					});
+					
+					reactor.wait(1.0);
+					
+					examiner.expect(identifiers.size()) == 2u;
+					
+					// Intermediate completions may also be dropped by the kernel if the error queue fills up, but the last send is scheduled and sent:
+					std::size_t last = 0;
+					
+					for (auto & completion : completions) {
+						examiner.expect(completion.identifier == identifiers[0] || completion.identifier == identifiers[1]) == true;
+						
+						if (completion.identifier == identifiers[1]) last += 1;
+					}
+					
+					examiner.expect(last) == 2u;
+				}
+			},
+			
+			{"it receives with a deadline",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					bool timed_out = false;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						// Never respond:
+						char buffer[1];
+						peer.receive(buffer, sizeof(buffer), reactor);
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						Timestamping timestamping(client, reactor);
+						
+						timestamping.send("Hello World!", 12);
+						
+						try {
+							char buffer[12];
+							Timestamping::Nanoseconds received;
+							Deadline deadline(0.05);
+							
+							timestamping.receive(buffer, sizeof(buffer), received, deadline);
+						} catch (std::system_error & error) {
+							timed_out = error.code().value() == ETIMEDOUT;
+						}
+					});
+					
+					reactor.wait(0.2);
+					
+					examiner.expect(timed_out) == true;
+				}
+			},
+		};
+	}
+}
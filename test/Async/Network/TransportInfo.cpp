@@ -0,0 +1,161 @@
+//
+//  TransportInfo.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/TransportSampler.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+#include <Async/After.hpp>
+
+#include <netinet/tcp.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		UnitTest::Suite TransportInfoTestSuite {
+			"Async::Network::TransportInfo",
+			
+			{"it reports the state of a connection",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					TransportInfo info;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						char buffer[12];
+						peer.receive(buffer, sizeof(buffer), reactor);
+						peer.send(buffer, sizeof(buffer), reactor);
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						
+						char buffer[12];
+						client.send("Hello World!", 12, reactor);
+						client.receive(buffer, sizeof(buffer), reactor);
+						
+						info = client.transport_info();
+					});
+					
+					reactor.wait(1.0);
+					
+					examiner << "round trip time: " << info.round_trip_time << "s, congestion window: " << info.congestion_window << ", pacing rate: " << info.pacing_rate << std::endl;
+					
+					examiner.expect(info.state) == int(TCP_ESTABLISHED);
+					examiner.expect(info.round_trip_time).to(be > Time::Interval(0));
+					examiner.expect(info.round_trip_time).to(be < Time::Interval(1));
+					examiner.expect(info.congestion_window).to(be > 0u);
+					examiner.expect(info.maximum_segment_size).to(be > 0u);
+					examiner.expect(info.total_retransmits) == 0u;
+				}
+			},
+			
+			{"it fails on a socket which is not TCP",
+				[](UnitTest::Examiner & examiner) {
+					auto socket = Endpoint::named_endpoints("127.0.0.1", 0, SOCK_DGRAM).front().bind();
+					
+					examiner.expect([&]{socket.transport_info();}).to(throw_exception<std::system_error>());
+				}
+			},
+			
+			{"it samples live connections",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					TransportSampler sampler(reactor, 0.01);
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						sampler.add(peer);
+						
+						char buffer[1024];
+						while (peer.receive(buffer, sizeof(buffer), reactor) > 0);
+						
+						sampler.remove(peer);
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						sampler.add(client);
+						
+						std::string chunk(1024, 'x');
+						
+						for (std::size_t i = 0; i < 100; i += 1) {
+							client.send(chunk.data(), chunk.size(), reactor);
+							After(0.001, reactor).wait();
+						}
+						
+						sampler.remove(client);
+					});
+					
+					reactor.wait(0.2);
+					
+					auto & round_trip_time = sampler.round_trip_time();
+					
+					examiner << "samples: " << sampler.samples() << ", round trip time p50: " << round_trip_time.percentile(50) << "us, p99: " << round_trip_time.percentile(99) << "us" << std::endl;
+					
+					examiner.expect(sampler.samples()).to(be > 0u);
+					examiner.expect(round_trip_time.count()).to(be > 0u);
+					examiner.expect(sampler.congestion_window().minimum()).to(be > 0u);
+					examiner.expect(sampler.retransmits().maximum()) == 0u;
+					examiner.expect(sampler.size()) == 0u;
+				}
+			},
+			
+			{"it drops connections which were closed without being removed",
+				[](UnitTest::Examiner & examiner) {
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					TransportSampler sampler(reactor, 60);
+					Descriptor closed = -1, reused = -1;
+					
+					fibers.resume([&]{
+						{
+							auto client = Endpoint(server).connect(reactor);
+							sampler.add(client);
+							closed = client.descriptor();
+						}
+						
+						// The next socket usually gets the same descriptor:
+						auto client = Endpoint(server).connect(reactor);
+						reused = client.descriptor();
+						
+						sampler.sample();
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner << "closed: " << closed << ", reused: " << reused << std::endl;
+					
+					examiner.expect(sampler.size()) == 0u;
+					examiner.expect(sampler.round_trip_time().count()) == 0u;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,218 @@
+//
+//  UnixDomain.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+
+#include <Time/Statistics.hpp>
+
+#include <sstream>
+#include <unistd.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		static std::string temporary_path(const char * name)
+		{
+			return "/tmp/async-network-" + std::to_string(::getpid()) + "-" + name + ".sock";
+		}
+		
+		// Echo single byte messages between a client and server for a short time, returning the round trip statistics.
+		static Time::Statistics ping_pong(const Endpoint & endpoint)
+		{
+			auto server = endpoint.bind();
+			server.listen();
+			
+			Reactor reactor;
+			Fiber::Pool fibers;
+			Time::Statistics statistics;
+			
+			fibers.resume([&]{
+				auto peer = server.accept(reactor);
+				char byte;
+				
+				while (peer.receive(&byte, 1, reactor)) {
+					peer.send(&byte, 1, reactor);
+				}
+			});
+			
+			fibers.resume([&]{
+				auto client = Endpoint(server).connect(reactor);
+				char byte = 'x';
+				
+				while (true) {
+					auto sample = statistics.sample();
+					
+					client.send(&byte, 1, reactor);
+					client.receive(&byte, 1, reactor);
+				}
+			});
+			
+			reactor.wait(0.5);
+			
+			return statistics;
+		}
+		
+		UnitTest::Suite UnixDomainTestSuite {
+			"Async::Network::UnixDomain",
+			
+			{"it formats paths and abstract names",
+				[](UnitTest::Examiner & examiner) {
+					auto address = Address::unix_domain("/run/app.sock");
+					
+					examiner.expect(address.family()) == AF_UNIX;
+					examiner.expect(address.unix_path()) == "/run/app.sock";
+					examiner.expect(address.canonical_name()) == "/run/app.sock";
+					
+					std::stringstream output;
+					output << address << " " << Address::unix_domain("@app");
+					
+					examiner.expect(output.str()) == "unix:/run/app.sock unix:@app";
+					
+					examiner.expect(Address::unix_domain("").unix_path()) == "";
+					examiner.expect([]{Address::unix_domain(std::string(200, 'x'));}).to(throw_exception<std::invalid_argument>());
+				}
+			},
+			
+			{"it parses unix URIs",
+				[](UnitTest::Examiner & examiner) {
+					auto stream = Endpoint::named_endpoints(URI::Generic("unix:/run/app.sock"));
+					
+					examiner.expect(stream.size()) == 1u;
+					examiner.expect(stream.front().socket_domain()) == AF_UNIX;
+					examiner.expect(stream.front().socket_type()) == SOCK_STREAM;
+					examiner.expect(stream.front().address().unix_path()) == "/run/app.sock";
+					
+					auto datagram = Endpoint::named_endpoints(URI::Generic("unix:@app#datagram"));
+					
+					examiner.expect(datagram.front().socket_type()) == SOCK_DGRAM;
+					examiner.expect(datagram.front().address().unix_path()) == "@app";
+				}
+			},
+			
+			{"it connects through a path",
+				[](UnitTest::Examiner & examiner) {
+					auto path = temporary_path("stream");
+					::unlink(path.c_str());
+					
+					auto server = Endpoint::unix_domain(path).bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::string message;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						
+						char buffer[12];
+						auto size = peer.receive(buffer, sizeof(buffer), reactor);
+						
+						message.assign(buffer, size);
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						
+						client.send("Hello World!", 12, reactor);
+					});
+					
+					reactor.wait(0.1);
+					::unlink(path.c_str());
+					
+					examiner.expect(Endpoint(server).address().unix_path()) == path;
+					examiner.expect(message) == "Hello World!";
+				}
+			},
+			
+			{"it sends datagrams to an abstract name",
+				[](UnitTest::Examiner & examiner) {
+					auto name = "@" + temporary_path("datagram");
+					
+					auto server = Endpoint::unix_domain(name, SOCK_DGRAM).bind();
+					auto client = Endpoint::unix_domain("", SOCK_DGRAM).bind();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::string message;
+					Address sender;
+					
+					fibers.resume([&]{
+						char buffer[12];
+						auto size = server.receive_from(buffer, sizeof(buffer), sender, reactor);
+						
+						message.assign(buffer, size);
+					});
+					
+					fibers.resume([&]{
+						client.send_to("Hello World!", 12, Address::unix_domain(name), reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(message) == "Hello World!";
+					examiner.expect(sender.unix_path()) == client.local_address().unix_path();
+				}
+			},
+			
+			{"it creates connected pairs",
+				[](UnitTest::Examiner & examiner) {
+					auto sockets = Socket::pair();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::string message;
+					
+					fibers.resume([&]{
+						char buffer[12];
+						auto size = sockets.second.receive(buffer, sizeof(buffer), reactor);
+						
+						message.assign(buffer, size);
+					});
+					
+					fibers.resume([&]{
+						sockets.first.send("Hello World!", 12, reactor);
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(sockets.first.domain()) == AF_UNIX;
+					examiner.expect(message) == "Hello World!";
+				}
+			},
+			
+			{"it has lower latency than loopback TCP",
+				[](UnitTest::Examiner & examiner) {
+					auto path = temporary_path("latency");
+					::unlink(path.c_str());
+					
+					auto unix_statistics = ping_pong(Endpoint::unix_domain(path));
+					auto tcp_statistics = ping_pong(Endpoint::named_endpoints("127.0.0.1", 0).front());
+					
+					::unlink(path.c_str());
+					
+					examiner << "UNIX domain round trips per second: " << unix_statistics.samples_per_second() << std::endl;
+					examiner << "Loopback TCP round trips per second: " << tcp_statistics.samples_per_second() << std::endl;
+					
+					examiner.expect(unix_statistics.samples_per_second()).to(be > 100);
+					examiner.expect(unix_statistics.samples_per_second()).to(be > tcp_statistics.samples_per_second());
+				}
+			},
+		};
+	}
+}
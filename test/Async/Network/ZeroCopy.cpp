@@ -0,0 +1,186 @@
+//
+//  ZeroCopy.cpp
+//  This file is part of the "Async::Network" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 17/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Concurrent/Fiber.hpp>
+#include <Async/Network/ZeroCopy.hpp>
+#include <Async/Network/Timestamping.hpp>
+#include <Async/Network/Endpoint.hpp>
+#include <Async/Reactor.hpp>
+
+#include <Time/Timer.hpp>
+
+#include <ctime>
+#include <signal.h>
+
+namespace Async
+{
+	namespace Network
+	{
+		using Concurrent::Fiber;
+		using namespace UnitTest::Expectations;
+		
+		// Send total bytes in chunks over loopback, returning the CPU time used per gigabyte.
+		static double cpu_per_gigabyte(UnitTest::Examiner & examiner, std::size_t threshold)
+		{
+			const std::size_t chunk_size = 1024*1024, total = 256*chunk_size;
+			
+			auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+			server.listen();
+			
+			Reactor reactor;
+			Fiber::Pool fibers;
+			
+			std::size_t received = 0, released = 0;
+			std::clock_t cpu = 0;
+			
+			fibers.resume([&]{
+				auto peer = server.accept(reactor);
+				Readable event(peer, reactor);
+				
+				std::string buffer(chunk_size, '\0');
+				
+				while (true) {
+					auto result = ::recv(peer, &buffer[0], buffer.size(), 0);
+					
+					if (result == 0) break;
+					else if (result == -1) event.wait();
+					else received += result;
+				}
+			});
+			
+			fibers.resume([&]{
+				auto client = Endpoint(server).connect(reactor);
+				
+				std::vector<ZeroCopySender::Buffer> buffers(8, ZeroCopySender::Buffer(chunk_size, 'x'));
+				ZeroCopySender sender(client, reactor, [&](ZeroCopySender::Buffer && buffer){
+					released += 1;
+					buffers.push_back(std::move(buffer));
+				}, threshold);
+				
+				auto start = std::clock();
+				
+				for (std::size_t sent = 0; sent < total; sent += chunk_size) {
+					while (buffers.empty()) sender.flush();
+					
+					auto buffer = std::move(buffers.back());
+					buffers.pop_back();
+					
+					sender.write(std::move(buffer));
+				}
+				
+				sender.flush();
+				cpu = std::clock() - start;
+				
+				examiner << "Zero copy enabled: " << sender.enabled() << ", copied completions: " << sender.copied() << std::endl;
+				
+				client.shutdown_write();
+			});
+			
+			reactor.wait(5.0);
+			
+			examiner.expect(received) == total;
+			examiner.expect(released) == total / chunk_size;
+			
+			return (double(cpu) / CLOCKS_PER_SEC) / (double(total) / (1024*1024*1024));
+		}
+		
+		UnitTest::Suite ZeroCopyTestSuite {
+			"Async::Network::ZeroCopy",
+			
+			{"it releases small buffers immediately",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t released = 0;
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						
+						ZeroCopySender sender(client, reactor, [&](ZeroCopySender::Buffer &&){
+							released += 1;
+						});
+						
+						sender.write("Hello World!");
+						examiner.expect(sender.pending()) == 0u;
+					});
+					
+					reactor.wait(0.1);
+					
+					examiner.expect(released) == 1u;
+				}
+			},
+			
+			{"it ignores timestamps on the error queue",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					auto server = Endpoint::named_endpoints("127.0.0.1", 0).front().bind();
+					server.listen();
+					
+					Reactor reactor;
+					Fiber::Pool fibers;
+					
+					std::size_t released = 0;
+					
+					fibers.resume([&]{
+						auto peer = server.accept(reactor);
+						char buffer[64*1024];
+						
+						while (peer.receive(buffer, sizeof(buffer), reactor)) {}
+					});
+					
+					fibers.resume([&]{
+						auto client = Endpoint(server).connect(reactor);
+						
+						// Send timestamps are reported on the same error queue as zero-copy completions:
+						Timestamping timestamping(client, reactor);
+						
+						ZeroCopySender sender(client, reactor, [&](ZeroCopySender::Buffer &&){
+							released += 1;
+						});
+						
+						for (std::size_t i = 0; i < 8; i += 1) {
+							sender.write(ZeroCopySender::Buffer(64*1024, 'x'));
+						}
+						
+						sender.flush();
+						client.shutdown_write();
+					});
+					
+					reactor.wait(1.0);
+					
+					examiner.expect(released) == 8u;
+				}
+			},
+			
+			{"it releases every buffer when sending a gigabyte with and without zero copy",
+				[](UnitTest::Examiner & examiner) {
+					signal(SIGPIPE, SIG_IGN);
+					
+					// The received and released totals are checked for each run. Loopback copies regardless, so the CPU time is reported but not compared:
+					auto copying = cpu_per_gigabyte(examiner, ~std::size_t(0));
+					auto zero_copy = cpu_per_gigabyte(examiner, 16*1024);
+					
+					examiner << "Copying: " << copying << "s CPU per GB." << std::endl;
+					examiner << "Zero copy: " << zero_copy << "s CPU per GB." << std::endl;
+					
+					examiner.expect(copying) > 0;
+					examiner.expect(zero_copy) > 0;
+				}
+			},
+		};
+	}
+}